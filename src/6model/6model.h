@@ -134,7 +134,11 @@ typedef enum {
     /* Note: if you're hunting for a flag, some day in the future when we
      * have used them all, this one is easy enough to eliminate by having the
      * tiny number of objects marked this way in a remembered set. */
-    MVM_CF_NEVER_REPOSSESS = 32
+    MVM_CF_NEVER_REPOSSESS = 32,
+
+    /* Is this (VMArray) object's storage a file mapping, to be unmapped
+     * rather than freed? */
+    MVM_CF_MAPPED_MEMORY = 64
 } MVMCollectableFlags1;
 
 typedef enum {
@@ -742,6 +742,83 @@ MVM_PUBLIC void MVM_repr_bind_attr_inso(MVMThreadContext *tc, MVMObject *object,
     MVM_SC_WB_OBJ(tc, object);
 }
 
+/* Looks up the slot of an attribute through an inline cache, falling back
+ * to the REPR's hint_for on a miss. Only P6opaque is cached; since type cache
+ * IDs are never reused, an entry can never go stale by a type being freed and
+ * another allocated in its place. Returns the hint to pass to the REPR. */
+#define ATTR_CACHE_SLOT_MASK 0xFF
+static MVMint16 attr_cache_hint(MVMThreadContext *tc, MVMAttrCache *cache, MVMObject *object,
+                                MVMObject *type, MVMString *name, MVMint16 hint) {
+    MVMSTable *st;
+    AO_t class_id, id, entry;
+    MVMint64 slot;
+    MVMuint32 i;
+    if (!IS_CONCRETE(object) || REPR(object)->ID != MVM_REPR_ID_P6opaque
+            || MVM_is_null(tc, type) || STABLE(type)->WHAT != type)
+        return hint;
+
+    /* Entries are only meaningful for one class handle; the first one we
+     * see claims the cache, and other ones just don't get cached. */
+    class_id = MVM_load(&cache->class_id);
+    if (class_id != (AO_t)STABLE(type)->type_cache_id) {
+        if (class_id != 0)
+            return hint;
+        MVM_trycas(&cache->class_id, 0, (AO_t)STABLE(type)->type_cache_id);
+        if (MVM_load(&cache->class_id) != (AO_t)STABLE(type)->type_cache_id)
+            return hint;
+    }
+
+    st = STABLE(object);
+    id = (AO_t)st->type_cache_id;
+    for (i = 0; i < MVM_ATTR_CACHE_ENTRIES; i++) {
+        entry = MVM_load(&cache->entries[i]);
+        if (entry == 0)
+            break;
+        if ((entry & ~(AO_t)ATTR_CACHE_SLOT_MASK) == id)
+            return (MVMint16)((entry & ATTR_CACHE_SLOT_MASK) - 1);
+    }
+
+    /* Miss; look the slot up and claim an empty entry, if there is one. */
+    slot = REPR(object)->attr_funcs.hint_for(tc, st, type, name);
+    if (slot < 0 || slot >= ATTR_CACHE_SLOT_MASK)
+        return hint;
+    for (; i < MVM_ATTR_CACHE_ENTRIES; i++)
+        if (MVM_trycas(&cache->entries[i], 0, id | (AO_t)(slot + 1)))
+            break;
+    return (MVMint16)slot;
+}
+
+MVM_PUBLIC MVMint64 MVM_repr_get_attr_i_cached(MVMThreadContext *tc, MVMObject *object, MVMObject *type,
+                                               MVMString *name, MVMint16 hint, MVMAttrCache *cache) {
+    return MVM_repr_get_attr_i(tc, object, type, name,
+        attr_cache_hint(tc, cache, object, type, name, hint));
+}
+
+MVM_PUBLIC MVMnum64 MVM_repr_get_attr_n_cached(MVMThreadContext *tc, MVMObject *object, MVMObject *type,
+                                               MVMString *name, MVMint16 hint, MVMAttrCache *cache) {
+    return MVM_repr_get_attr_n(tc, object, type, name,
+        attr_cache_hint(tc, cache, object, type, name, hint));
+}
+
+MVM_PUBLIC MVMString * MVM_repr_get_attr_s_cached(MVMThreadContext *tc, MVMObject *object, MVMObject *type,
+                                                  MVMString *name, MVMint16 hint, MVMAttrCache *cache) {
+    return MVM_repr_get_attr_s(tc, object, type, name,
+        attr_cache_hint(tc, cache, object, type, name, hint));
+}
+
+MVM_PUBLIC MVMObject * MVM_repr_get_attr_o_cached(MVMThreadContext *tc, MVMObject *object, MVMObject *type,
+                                                  MVMString *name, MVMint16 hint, MVMAttrCache *cache) {
+    return MVM_repr_get_attr_o(tc, object, type, name,
+        attr_cache_hint(tc, cache, object, type, name, hint));
+}
+
+MVM_PUBLIC void MVM_repr_bind_attr_inso_cached(MVMThreadContext *tc, MVMObject *object, MVMObject *type,
+                                               MVMString *name, MVMint16 hint, MVMRegister value_reg,
+                                               MVMuint16 kind, MVMAttrCache *cache) {
+    MVM_repr_bind_attr_inso(tc, object, type, name,
+        attr_cache_hint(tc, cache, object, type, name, hint), value_reg, kind);
+}
+
 MVM_PUBLIC MVMint64 MVM_repr_attribute_inited(MVMThreadContext *tc, MVMObject *obj, MVMObject *type,
                                               MVMString *name) {
     if (!IS_CONCRETE(obj))
@@ -118,6 +118,29 @@ MVM_PUBLIC MVMObject * MVM_repr_get_attr_o(MVMThreadContext *tc, MVMObject *obje
 MVM_PUBLIC void        MVM_repr_bind_attr_inso(MVMThreadContext *tc, MVMObject *object, MVMObject *type,
                                                MVMString *name, MVMint16 hint, MVMRegister value_reg, MVMuint16 kind);
 
+/* A small inline cache for an attribute access site, mapping the type of the
+ * object being accessed to the slot the attribute lives in. Each entry packs
+ * the type cache ID (which has its low bits free) with the slot plus one, so
+ * an entry can be filled with a single CAS and an empty entry is zero. All of
+ * the entries are only valid for the class handle recorded in class_id. */
+#define MVM_ATTR_CACHE_ENTRIES 4
+struct MVMAttrCache {
+    AO_t class_id;
+    AO_t entries[MVM_ATTR_CACHE_ENTRIES];
+};
+
+MVM_PUBLIC MVMint64    MVM_repr_get_attr_i_cached(MVMThreadContext *tc, MVMObject *object, MVMObject *type,
+                                                  MVMString *name, MVMint16 hint, MVMAttrCache *cache);
+MVM_PUBLIC MVMnum64    MVM_repr_get_attr_n_cached(MVMThreadContext *tc, MVMObject *object, MVMObject *type,
+                                                  MVMString *name, MVMint16 hint, MVMAttrCache *cache);
+MVM_PUBLIC MVMString * MVM_repr_get_attr_s_cached(MVMThreadContext *tc, MVMObject *object, MVMObject *type,
+                                                  MVMString *name, MVMint16 hint, MVMAttrCache *cache);
+MVM_PUBLIC MVMObject * MVM_repr_get_attr_o_cached(MVMThreadContext *tc, MVMObject *object, MVMObject *type,
+                                                  MVMString *name, MVMint16 hint, MVMAttrCache *cache);
+MVM_PUBLIC void        MVM_repr_bind_attr_inso_cached(MVMThreadContext *tc, MVMObject *object, MVMObject *type,
+                                                      MVMString *name, MVMint16 hint, MVMRegister value_reg,
+                                                      MVMuint16 kind, MVMAttrCache *cache);
+
 MVM_PUBLIC MVMint64   MVM_repr_attribute_inited(MVMThreadContext *tc, MVMObject *object, MVMObject *type,
                                                 MVMString *name);
 
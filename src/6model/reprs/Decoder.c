@@ -255,7 +255,7 @@ MVMString * MVM_decoder_take_chars(MVMThreadContext *tc, MVMDecoder *decoder, MV
         result = MVM_string_decodestream_get_chars(tc, get_ds(tc, decoder), (MVMint32)chars, eof);
     });
     exit_single_user(tc, decoder);
-    return result;
+    return MVM_string_intern_decoded(tc, result);
 }
 
 /* Takes all chars from the decoder. */
@@ -293,7 +293,7 @@ MVMString * MVM_decoder_take_line(MVMThreadContext *tc, MVMDecoder *decoder,
             : MVM_string_decodestream_get_until_sep(tc, ds, sep_spec, (MVMint32)chomp);
     });
     exit_single_user(tc, decoder);
-    return result;
+    return MVM_string_intern_decoded(tc, result);
 }
 
 /* Returns true if the decoder is empty. */
@@ -23,6 +23,9 @@ struct MVMAsyncTaskBody {
     /* The cancellation notification handler, if any. */
     MVMObject *cancel_notify_schedulee;
 
+    /* The event loop the task runs on; NULL until it is assigned one. */
+    MVMIOEventLoop *event_loop;
+
     /* The current state of the task. */
     MVMint32 state;
 };
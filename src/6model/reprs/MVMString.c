@@ -42,10 +42,13 @@ static void copy_to(MVMThreadContext *tc, MVMSTable *st, void *src, MVMObject *d
             }
             break;
         case MVM_STRING_STRAND:
-            dest_body->storage.strands = MVM_malloc(dest_body->num_strands * sizeof(MVMStringStrand));
+            dest_body->storage.strands = MVM_malloc(MVM_STRING_STRANDS_SIZE(dest_body->num_strands));
             memcpy(dest_body->storage.strands, src_body->storage.strands,
                 dest_body->num_strands * sizeof(MVMStringStrand));
             break;
+        case MVM_STRING_IN_SITU_8:
+            dest_body->storage = src_body->storage;
+            break;
         default:
             MVM_exception_throw_adhoc(tc, "Internal string corruption");
     }
@@ -65,7 +68,10 @@ static void gc_mark(MVMThreadContext *tc, MVMSTable *st, void *data, MVMGCWorkli
 /* Called by the VM in order to free memory associated with this object. */
 static void gc_free(MVMThreadContext *tc, MVMObject *obj) {
     MVMString *str = (MVMString *)obj;
-    MVM_free(str->body.storage.any);
+    if (MVM_string_is_interned(str))
+        MVM_string_intern_forget(tc, str);
+    if (str->body.storage_type != MVM_STRING_IN_SITU_8)
+        MVM_free(str->body.storage.any);
     str->body.num_graphs = str->body.num_strands = 0;
 }
 
@@ -95,7 +101,9 @@ static MVMuint64 unmanaged_size(MVMThreadContext *tc, MVMSTable *st, void *data)
         case MVM_STRING_GRAPHEME_32:
             return sizeof(MVMGrapheme32) * body->num_graphs;
         case MVM_STRING_STRAND:
-            return sizeof(MVMStringStrand) * body->num_strands;
+            return MVM_STRING_STRANDS_SIZE(body->num_strands);
+        case MVM_STRING_IN_SITU_8:
+            return 0;
         default:
             return body->num_graphs;
     }
@@ -1,12 +1,17 @@
 /* Representation used by VM-level strings.
  *
- * Strings come in one of 3 forms today, with 1 expected future form:
+ * Strings come in one of 4 forms:
  *   - 32-bit buffer of graphemes (Unicode codepoints or synthetic codepoints)
  *   - 8-bit buffer of codepoints that all fall in the ASCII range
- *   - Buffer of strands
- *   - (LATER) 8-bit buffer of codepoints with negatives as synthetics (we
+ *   - 8-bit buffer of Latin-1 codepoints, with the C1 control range used for
+ *     the first few synthetics instead (see MVM_grapheme8_to_32 below; we
  *     draw out a distinction with the ASCII range buffer because we can do
  *     some I/O simplifications when we know all is in the ASCII range).
+ *   - Buffer of strands
+ *   - Up to 8 graphemes in the same 8-bit encoding, stored in situ; that is,
+ *     in the space that would otherwise hold the pointer to the buffer.
+ *     This saves an allocation, and an indirection, for the many short
+ *     strings (hash keys, identifiers, single characters) a program makes.
  *
  * A buffer of strands represents a string made up of other non-strand
  * strings. That is, there's no recursive strands. This simplifies the
@@ -18,13 +23,23 @@
 /* Kinds of grapheme we may hold in a string. */
 typedef MVMint32 MVMGrapheme32;
 typedef MVMint8  MVMGraphemeASCII;
-typedef MVMint8  MVMGrapheme8;       /* Future use */
+typedef MVMuint8 MVMGrapheme8;
 
 /* What kind of data is a string storing? */
 #define MVM_STRING_GRAPHEME_32      0
 #define MVM_STRING_GRAPHEME_ASCII   1
 #define MVM_STRING_GRAPHEME_8       2
 #define MVM_STRING_STRAND           3
+#define MVM_STRING_IN_SITU_8        4
+
+/* Maximum number of graphemes that can be stored in situ. */
+#define MVM_STRING_IN_SITU_8_MAX    8
+
+/* Flags that may be set on a string. MVM_STRING_FLAG_INTERNED is only set by
+ * MVM_string_intern, and promises that no other string with the flag has the
+ * same contents, so code that copies a string must never copy body.flags. */
+#define MVM_STRING_FLAG_INTERNED        1
+#define MVM_STRING_FLAG_STRAND_INDEX    2
 
 /* String index data type, for when we talk about indexes. */
 typedef MVMuint32 MVMStringIndex;
@@ -35,16 +50,28 @@ typedef MVMint32 MVMCodepoint;
 /* Maximum number of strands we will have. */
 #define MVM_STRING_MAX_STRANDS  64
 
+/* Strand storage is allocated with room after the strands for an index of
+ * the grapheme offset each strand starts at. It's filled in lazily, the first
+ * time we need to seek into the string, and MVM_STRING_FLAG_STRAND_INDEX is
+ * set once it's valid. */
+#define MVM_STRING_STRANDS_SIZE(num_strands) \
+    ((num_strands) * (sizeof(MVMStringStrand) + sizeof(MVMStringIndex)))
+
+/* The storage of a string; which member is valid depends on storage_type. */
+union MVMStringStorage {
+    MVMGrapheme32    *blob_32;
+    MVMGraphemeASCII *blob_ascii;
+    MVMGrapheme8     *blob_8;
+    MVMStringStrand  *strands;
+    MVMGrapheme8      in_situ_8[MVM_STRING_IN_SITU_8_MAX];
+    void             *any;
+};
+
 /* The body of a string. */
 struct MVMStringBody {
-    union {
-        MVMGrapheme32    *blob_32;
-        MVMGraphemeASCII *blob_ascii;
-        MVMGrapheme8     *blob_8;
-        MVMStringStrand  *strands;
-        void             *any;
-    } storage;
-    MVMuint16 storage_type;
+    MVMStringStorage storage;
+    MVMuint8  storage_type;
+    MVMuint8  flags;
     MVMuint16 num_strands;
     MVMuint32 num_graphs;
     MVMHashv  cached_hash_code;
@@ -71,3 +98,37 @@ struct MVMString {
 
 /* Function for REPR setup. */
 const MVMREPROps * MVMString_initialize(MVMThreadContext *tc);
+
+/* 8-bit strings store codepoints 0x00..0xFF as themselves, except for the C1
+ * controls 0x80..0x9F, which are next to never seen in text. Those bytes are
+ * instead used for the synthetics -1..-32, so that strings containing the
+ * most common synthetics (not least \r\n) still get 8-bit storage. */
+#define MVM_GRAPHEME8_SYNTH_BASE  0x7F
+#define MVM_GRAPHEME8_NUM_SYNTHS  32
+MVM_STATIC_INLINE MVMGrapheme32 MVM_grapheme8_to_32(MVMGrapheme8 g) {
+    return (MVMuint8)(g - 0x80) < MVM_GRAPHEME8_NUM_SYNTHS
+        ? MVM_GRAPHEME8_SYNTH_BASE - (MVMGrapheme32)g
+        : (MVMGrapheme32)g;
+}
+MVM_STATIC_INLINE MVMGrapheme8 MVM_grapheme32_to_8(MVMGrapheme32 g) {
+    return (MVMGrapheme8)(g < 0 ? MVM_GRAPHEME8_SYNTH_BASE - g : g);
+}
+MVM_STATIC_INLINE int MVM_grapheme32_can_fit_into_8bit(MVMGrapheme32 g) {
+    return (MVMuint32)g < 0x80
+        || (MVMuint32)(g - 0xA0) < 0x60
+        || (MVMuint32)(g + MVM_GRAPHEME8_NUM_SYNTHS) < MVM_GRAPHEME8_NUM_SYNTHS;
+}
+
+/* Gets a pointer to the graphemes of a string with 8-bit storage, whether
+ * they are in a blob or in situ. Note that in the latter case the pointer is
+ * into the string itself, so is only valid until the next GC allocation. */
+MVM_STATIC_INLINE MVMGrapheme8 * MVM_string_blob_8(MVMString *s) {
+    return s->body.storage_type == MVM_STRING_IN_SITU_8
+        ? s->body.storage.in_situ_8
+        : s->body.storage.blob_8;
+}
+MVM_STATIC_INLINE int MVM_string_storage_is_8bit(MVMuint16 storage_type) {
+    return storage_type == MVM_STRING_GRAPHEME_8
+        || storage_type == MVM_STRING_GRAPHEME_ASCII
+        || storage_type == MVM_STRING_IN_SITU_8;
+}
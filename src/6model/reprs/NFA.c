@@ -50,6 +50,11 @@ static void gc_free(MVMThreadContext *tc, MVMObject *obj) {
             MVM_fixed_size_free(tc, tc->instance->fsa, nfa->body.num_state_edges[i] * sizeof(MVMNFAStateInfo), nfa->body.states[i]);
     MVM_fixed_size_free(tc, tc->instance->fsa, nfa->body.num_states * sizeof(MVMNFAStateInfo *), nfa->body.states);
     MVM_fixed_size_free(tc, tc->instance->fsa, nfa->body.num_states * sizeof(MVMint64), nfa->body.num_state_edges);
+    if (nfa->body.compiled) {
+        MVM_free(nfa->body.compiled->edge_start);
+        MVM_free(nfa->body.compiled->edges);
+        MVM_free(nfa->body.compiled);
+    }
 }
 
 
@@ -312,6 +317,11 @@ static MVMuint64 unmanaged_size(MVMThreadContext *tc, MVMSTable *st, void *data)
     total += body->num_states * sizeof(MVMNFAStateInfo *); /* for states level 1 */
     for (i = 0; i < body->num_states; i++)
         total += body->num_state_edges[i] * sizeof(MVMNFAStateInfo);
+    if (body->compiled) {
+        total += sizeof(MVMNFACompiled);
+        total += (body->num_states + 1) * sizeof(MVMint64);
+        total += body->compiled->num_edges * sizeof(MVMNFACompiledEdge);
+    }
 
     return total;
 }
@@ -471,26 +481,133 @@ MVMObject * MVM_nfa_from_statelist(MVMThreadContext *tc, MVMObject *states, MVMO
     return nfa_obj;
 }
 
-/* Does a run of the NFA. Produces a list of integers indicating the
- * chosen ordering. */
-static MVMint32 in_done(MVMuint32 *done, MVMuint32 numdone, MVMuint32 st) {
-    MVMuint32 i = 0;
-    for (i = 0; i < numdone; i++)
-        if (done[i] == st)
-            return 1;
-    return 0;
+/* Normalizes a grapheme that an edge wants to compare against the base
+ * character of the target to NFD, so it's in the same form. */
+static MVMGrapheme32 nfd_edge_grapheme(MVMThreadContext *tc, MVMGrapheme32 g) {
+    MVMNormalizer norm;
+    MVMint32 ready;
+    MVM_unicode_normalizer_init(tc, &norm, MVM_NORMALIZE_NFD);
+    ready = MVM_unicode_normalizer_process_codepoint_to_grapheme(tc, &norm, g, &g);
+    MVM_unicode_normalizer_eof(tc, &norm);
+    if (!ready)
+        g = MVM_unicode_normalizer_get_grapheme(tc, &norm);
+    MVM_unicode_normalizer_cleanup(tc, &norm);
+    return g;
+}
+
+/* Compiles an NFA into a flat edge table. All of the edges end up in one
+ * contiguous array, which is far kinder to the cache than chasing a pointer
+ * per state, and anything about an edge that does not depend on the target
+ * string (literal fates encoded in the act, normalized forms of the
+ * arguments) is worked out here once rather than on every visit. The edges
+ * keep their order exactly, since it determines the order of the fates. */
+static MVMNFACompiled * compile_nfa(MVMThreadContext *tc, MVMNFABody *nfa) {
+    MVMNFACompiled *c = MVM_malloc(sizeof(MVMNFACompiled));
+    MVMint64 s, j, cur = 0;
+
+    c->edge_start = MVM_malloc((nfa->num_states + 1) * sizeof(MVMint64));
+    c->num_edges  = 0;
+    for (s = 0; s < nfa->num_states; s++)
+        c->num_edges += nfa->num_state_edges[s];
+    c->edges = c->num_edges
+        ? MVM_malloc(c->num_edges * sizeof(MVMNFACompiledEdge))
+        : NULL;
+
+    for (s = 0; s < nfa->num_states; s++) {
+        c->edge_start[s] = cur;
+        for (j = 0; j < nfa->num_state_edges[s]; j++) {
+            MVMNFAStateInfo    *orig = &(nfa->states[s][j]);
+            MVMNFACompiledEdge *e    = &(c->edges[cur++]);
+            MVMint64            act  = orig->act;
+            e->to   = (MVMint32)orig->to;
+            e->fate = 0;
+            e->arg.i = 0;
+
+            /* A negative act has a fate encoded in it, and is redispatched
+             * on its low byte. That never makes it a fate or epsilon edge. */
+            if (act < 0) {
+                e->fate = (act >> 8) & 0xfffff;
+                act &= 0xff;
+                if (act <= MVM_NFA_EDGE_EPSILON)
+                    act = MVM_NFA_EDGE_SYNTH_NOOP;
+            }
+            else if (act > MVM_NFA_EDGE_SYNTH_CP_COUNT) {
+                act = MVM_NFA_EDGE_SYNTH_NOOP;
+            }
+            e->act = (MVMint32)act;
+
+            switch (act) {
+                case MVM_NFA_EDGE_FATE:
+                case MVM_NFA_EDGE_CHARCLASS:
+                case MVM_NFA_EDGE_CHARCLASS_NEG:
+                case MVM_NFA_EDGE_SYNTH_CP_COUNT:
+                    e->arg.i = orig->arg.i;
+                    break;
+                case MVM_NFA_EDGE_CODEPOINT:
+                case MVM_NFA_EDGE_CODEPOINT_LL:
+                case MVM_NFA_EDGE_CODEPOINT_NEG:
+                    e->arg.g = orig->arg.g;
+                    break;
+                case MVM_NFA_EDGE_CODEPOINT_M:
+                case MVM_NFA_EDGE_CODEPOINT_M_NEG:
+                    e->arg.g = nfd_edge_grapheme(tc, orig->arg.g);
+                    break;
+                case MVM_NFA_EDGE_CHARLIST:
+                case MVM_NFA_EDGE_CHARLIST_NEG:
+                    e->arg.orig = orig;
+                    break;
+                case MVM_NFA_EDGE_CODEPOINT_IM:
+                case MVM_NFA_EDGE_CODEPOINT_IM_NEG:
+                    e->arg.uclc.uc = nfd_edge_grapheme(tc, orig->arg.uclc.uc);
+                    e->arg.uclc.lc = nfd_edge_grapheme(tc, orig->arg.uclc.lc);
+                    break;
+                case MVM_NFA_EDGE_CODEPOINT_I:
+                case MVM_NFA_EDGE_CODEPOINT_I_LL:
+                case MVM_NFA_EDGE_CODEPOINT_I_NEG:
+                case MVM_NFA_EDGE_CHARRANGE:
+                case MVM_NFA_EDGE_CHARRANGE_NEG:
+                case MVM_NFA_EDGE_CHARRANGE_M:
+                case MVM_NFA_EDGE_CHARRANGE_M_NEG:
+                    e->arg.uclc.uc = orig->arg.uclc.uc;
+                    e->arg.uclc.lc = orig->arg.uclc.lc;
+                    break;
+            }
+        }
+    }
+    c->edge_start[nfa->num_states] = cur;
+
+    return c;
 }
 
+/* Gets the compiled form of an NFA, compiling it if needed. NFAs are shared
+ * between threads, so if we race with another thread to compile it then one
+ * of them wins and the other result is thrown away. */
+static MVMNFACompiled * get_compiled(MVMThreadContext *tc, MVMNFABody *nfa) {
+    MVMNFACompiled *c = nfa->compiled;
+    if (MVM_UNLIKELY(!c)) {
+        c = compile_nfa(tc, nfa);
+        if (!MVM_trycas(&(nfa->compiled), NULL, c)) {
+            MVM_free(c->edge_start);
+            MVM_free(c->edges);
+            MVM_free(c);
+            c = nfa->compiled;
+        }
+    }
+    return c;
+}
+
+/* Does a run of the NFA. Produces a list of integers indicating the
+ * chosen ordering. */
 static MVMint64 * nqp_nfa_run(MVMThreadContext *tc, MVMNFABody *nfa, MVMString *target, MVMint64 offset, MVMint64 *total_fates_out) {
     MVMint64  eos     = MVM_string_graphs(tc, target);
-    MVMuint32 gen     = 1;
     MVMint64  numcur  = 0;
     MVMint64  numnext = 0;
-    MVMint64  numdone = 0;
+    MVMuint32 gen;
     MVMuint32 *done, *curst, *nextst;
     MVMint64  *fates, *longlit;
     MVMint64  i, fate_arr_len, num_states, total_fates, prev_fates, usedlonglit;
     MVMint64  orig_offset = offset;
+    MVMNFACompiled *compiled = get_compiled(tc, nfa);
     /* We used a cached grapheme iterator since we often request the same
      * grapheme multiple times, most common after that is requesting the next
      * grapheme. */
@@ -498,7 +615,9 @@ static MVMint64 * nqp_nfa_run(MVMThreadContext *tc, MVMNFABody *nfa, MVMString *
     int nfadeb = tc->instance->nfa_debug_enabled;
 
     /* Obtain or (re)allocate "done states", "current states" and "next
-     * states" arrays. */
+     * states" arrays. The done array is indexed by state, and holds the
+     * generation in which the state was last visited; a fresh allocation
+     * is zeroed so no state looks visited. */
     num_states = nfa->num_states;
     if (tc->nfa_alloc_states < num_states) {
         size_t alloc   = (num_states + 1) * sizeof(MVMuint32);
@@ -506,6 +625,7 @@ static MVMint64 * nqp_nfa_run(MVMThreadContext *tc, MVMNFABody *nfa, MVMString *
         tc->nfa_curst  = (MVMuint32 *)MVM_realloc(tc->nfa_curst, alloc);
         tc->nfa_nextst = (MVMuint32 *)MVM_realloc(tc->nfa_nextst, alloc);
         tc->nfa_alloc_states = num_states;
+        memset(tc->nfa_done, 0, alloc);
     }
     done   = tc->nfa_done;
     curst  = tc->nfa_curst;
@@ -536,100 +656,104 @@ static MVMint64 * nqp_nfa_run(MVMThreadContext *tc, MVMNFABody *nfa, MVMString *
     if (target->body.num_graphs) MVM_string_gi_cached_init(tc, &gic, target, 0);
 
     while (numnext && offset <= eos) {
+        /* The grapheme at this position, which every consuming edge tests. */
+        MVMGrapheme32 g = offset < eos
+            ? MVM_string_gi_cached_get_grapheme(tc, &gic, offset)
+            : 0;
+
         /* Swap next and current */
         MVMuint32 *temp = curst;
         curst   = nextst;
         nextst  = temp;
         numcur  = numnext;
         numnext = 0;
-        numdone = 0;
+
+        /* Start a new generation of done states, clearing them out should
+         * the generation counter wrap around. */
+        gen = ++tc->nfa_done_gen;
+        if (MVM_UNLIKELY(gen == 0)) {
+            memset(done, 0, (tc->nfa_alloc_states + 1) * sizeof(MVMuint32));
+            gen = tc->nfa_done_gen = 1;
+        }
 
         /* Save how many fates we have before this position is considered. */
         prev_fates = total_fates;
 
         if (MVM_UNLIKELY(nfadeb)) {
             if (offset < eos) {
-                MVMGrapheme32 cp = MVM_string_get_grapheme_at_nocheck(tc, target, offset);
-                fprintf(stderr,"%c with %"PRId64"s target %"PRIXPTR" offset %"PRId64"\n", cp, numcur, (uintptr_t)target, offset);
+                fprintf(stderr,"%c with %"PRId64"s target %"PRIXPTR" offset %"PRId64"\n", g, numcur, (uintptr_t)target, offset);
             }
             else {
                 fprintf(stderr,"EOS with %"PRId64"s\n", numcur);
             }
         }
         while (numcur) {
-            MVMNFAStateInfo *edge_info;
-            MVMint64         edge_info_elems;
+            MVMNFACompiledEdge *edge_info;
+            MVMint64            edge_info_elems;
 
             MVMint64 st = curst[--numcur];
             if (st <= num_states) {
-                if (in_done(done, numdone, st))
+                if (done[st] == gen)
                     continue;
-                done[numdone++] = st;
+                done[st] = gen;
             }
 
-            edge_info = nfa->states[st - 1];
-            edge_info_elems = nfa->num_state_edges[st - 1];
+            edge_info = compiled->edges + compiled->edge_start[st - 1];
+            edge_info_elems = compiled->edge_start[st] - compiled->edge_start[st - 1];
             if (MVM_UNLIKELY(nfadeb))
                 fprintf(stderr,"\t%"PRIi64"\t%"PRIi64"\t", st, edge_info_elems);
             for (i = 0; i < edge_info_elems; i++) {
-                MVMint64 act = edge_info[i].act;
-                MVMint64 to  = edge_info[i].to;
-
-                /* All the special cases are under one test. */
-                if (act <= MVM_NFA_EDGE_EPSILON) {
-                    if (act < 0) {
-                        /* Negative indicates a fate is encoded in the act of the codepoint edge. */
-                        /* These will redispatch to one of the _LL cases below */
-                        act &= 0xff;
-                    }
-                    else if (act == MVM_NFA_EDGE_FATE) {
-                        /* Crossed a fate edge. Check if we already saw this fate, and
-                         * if so remove the entry so we can re-add at the new token length. */
-                        MVMint64 arg = edge_info[i].arg.i;
-                        MVMint64 j;
-                        MVMint64 found_fate = 0;
-                        if (MVM_UNLIKELY(nfadeb))
-                            fprintf(stderr, "fate(%016llx) ", (long long unsigned int)arg);
-                        for (j = 0; j < total_fates; j++) {
-                            if (found_fate)
-                                fates[j - found_fate] = fates[j];
-                            if ((fates[j] & 0xffffff) == arg) {
-                                found_fate++;
-                                if (j < prev_fates)
-                                    prev_fates--;
-                            }
-                        }
-                        total_fates -= found_fate;
-                        if (arg < usedlonglit)
-                            arg -= longlit[arg] << 24;
-                        if (MVM_UNLIKELY(++total_fates > fate_arr_len)) {
-                            /* should never happen if nfa->fates is correct and dedup above works right */
-                            fprintf(stderr, "oops adding %016llx to\n", (long long unsigned int)arg);
-                            for (j = 0; j < total_fates - 1; j++) {
-                                fprintf(stderr, "  %016llx\n", (long long unsigned int)fates[j]);
-                            }
-                            fate_arr_len      = total_fates + 10;
-                            tc->nfa_fates     = (MVMint64 *)MVM_realloc(tc->nfa_fates,
-                                sizeof(MVMint64) * fate_arr_len);
-                            tc->nfa_fates_len = fate_arr_len;
-                            fates             = tc->nfa_fates;
+                const MVMint32 act = edge_info[i].act;
+                MVMint64       to  = edge_info[i].to;
+
+                if (act == MVM_NFA_EDGE_FATE) {
+                    /* Crossed a fate edge. Check if we already saw this fate, and
+                     * if so remove the entry so we can re-add at the new token length. */
+                    MVMint64 arg = edge_info[i].arg.i;
+                    MVMint64 j;
+                    MVMint64 found_fate = 0;
+                    if (MVM_UNLIKELY(nfadeb))
+                        fprintf(stderr, "fate(%016llx) ", (long long unsigned int)arg);
+                    for (j = 0; j < total_fates; j++) {
+                        if (found_fate)
+                            fates[j - found_fate] = fates[j];
+                        if ((fates[j] & 0xffffff) == arg) {
+                            found_fate++;
+                            if (j < prev_fates)
+                                prev_fates--;
                         }
-                        /* a small insertion sort */
-                        j = total_fates - 1;
-                        while (--j >= prev_fates && fates[j] < arg) {
-                            fates[j + 1] = fates[j];
+                    }
+                    total_fates -= found_fate;
+                    if (arg < usedlonglit)
+                        arg -= longlit[arg] << 24;
+                    if (MVM_UNLIKELY(++total_fates > fate_arr_len)) {
+                        /* should never happen if nfa->fates is correct and dedup above works right */
+                        fprintf(stderr, "oops adding %016llx to\n", (long long unsigned int)arg);
+                        for (j = 0; j < total_fates - 1; j++) {
+                            fprintf(stderr, "  %016llx\n", (long long unsigned int)fates[j]);
                         }
-                        fates[++j] = arg;
-                        continue;
+                        fate_arr_len      = total_fates + 10;
+                        tc->nfa_fates     = (MVMint64 *)MVM_realloc(tc->nfa_fates,
+                            sizeof(MVMint64) * fate_arr_len);
+                        tc->nfa_fates_len = fate_arr_len;
+                        fates             = tc->nfa_fates;
+                    }
+                    /* a small insertion sort */
+                    j = total_fates - 1;
+                    while (--j >= prev_fates && fates[j] < arg) {
+                        fates[j + 1] = fates[j];
                     }
-                    else if (act == MVM_NFA_EDGE_EPSILON && to <= num_states &&
-                            !in_done(done, numdone, to)) {
+                    fates[++j] = arg;
+                    continue;
+                }
+                else if (act == MVM_NFA_EDGE_EPSILON) {
+                    if (to <= num_states && done[to] != gen) {
                         if (to)
                             curst[numcur++] = to;
                         else if (MVM_UNLIKELY(nfadeb))  /* XXX should turn into a "can't happen" after rebootstrap */
                             fprintf(stderr, "  oops, ignoring epsilon to 0\n");
-                        continue;
                     }
+                    continue;
                 }
 
                 if (eos <= offset) {
@@ -639,9 +763,8 @@ static MVMint64 * nqp_nfa_run(MVMThreadContext *tc, MVMNFABody *nfa, MVMString *
                 else {
                     switch (act) {
                         case MVM_NFA_EDGE_CODEPOINT_LL: {
-                            const MVMGrapheme32 arg = edge_info[i].arg.g;
-                            if (MVM_string_gi_cached_get_grapheme(tc, &gic, offset) == arg) {
-                                MVMint64 fate = (edge_info[i].act >> 8) & 0xfffff;
+                            if (g == edge_info[i].arg.g) {
+                                MVMint64 fate = edge_info[i].fate;
                                 nextst[numnext++] = to;
                                 while (usedlonglit <= fate)
                                     longlit[usedlonglit++] = 0;
@@ -652,8 +775,7 @@ static MVMint64 * nqp_nfa_run(MVMThreadContext *tc, MVMNFABody *nfa, MVMString *
                             continue;
                         }
                         case MVM_NFA_EDGE_CODEPOINT: {
-                            const MVMGrapheme32 arg = edge_info[i].arg.g;
-                            if (MVM_string_gi_cached_get_grapheme(tc, &gic, offset) == arg) {
+                            if (g == edge_info[i].arg.g) {
                                 nextst[numnext++] = to;
                                 if (MVM_UNLIKELY(nfadeb))
                                     fprintf(stderr, "%d->%d ", (int)i, (int)to);
@@ -661,43 +783,35 @@ static MVMint64 * nqp_nfa_run(MVMThreadContext *tc, MVMNFABody *nfa, MVMString *
                             continue;
                         }
                         case MVM_NFA_EDGE_CODEPOINT_NEG: {
-                            const MVMGrapheme32 arg = edge_info[i].arg.g;
-                            if (MVM_string_gi_cached_get_grapheme(tc, &gic, offset) != arg)
+                            if (g != edge_info[i].arg.g)
                                 nextst[numnext++] = to;
                             continue;
                         }
                         case MVM_NFA_EDGE_CHARCLASS: {
-                            const MVMint64 arg = edge_info[i].arg.i;
-                            if (MVM_string_grapheme_is_cclass(tc, arg, MVM_string_gi_cached_get_grapheme(tc, &gic, offset)))
+                            if (MVM_string_grapheme_is_cclass(tc, edge_info[i].arg.i, g))
                                 nextst[numnext++] = to;
                             continue;
                         }
                         case MVM_NFA_EDGE_CHARCLASS_NEG: {
-                            const MVMint64 arg = edge_info[i].arg.i;
-                            if (!MVM_string_grapheme_is_cclass(tc, arg, MVM_string_gi_cached_get_grapheme(tc, &gic, offset)))
+                            if (!MVM_string_grapheme_is_cclass(tc, edge_info[i].arg.i, g))
                                 nextst[numnext++] = to;
                             continue;
                         }
                         case MVM_NFA_EDGE_CHARLIST: {
-                            MVMString *arg   = edge_info[i].arg.s;
-                            MVMGrapheme32 cp = MVM_string_gi_cached_get_grapheme(tc, &gic, offset);
-                            if (MVM_string_index_of_grapheme(tc, arg, cp) >= 0)
+                            MVMString *arg = edge_info[i].arg.orig->arg.s;
+                            if (MVM_string_index_of_grapheme(tc, arg, g) >= 0)
                                 nextst[numnext++] = to;
                             continue;
                         }
                         case MVM_NFA_EDGE_CHARLIST_NEG: {
-                            MVMString *arg    = edge_info[i].arg.s;
-                            const MVMGrapheme32 cp = MVM_string_gi_cached_get_grapheme(tc, &gic, offset);
-                            if (MVM_string_index_of_grapheme(tc, arg, cp) < 0)
+                            MVMString *arg = edge_info[i].arg.orig->arg.s;
+                            if (MVM_string_index_of_grapheme(tc, arg, g) < 0)
                                 nextst[numnext++] = to;
                             continue;
                         }
                         case MVM_NFA_EDGE_CODEPOINT_I_LL: {
-                            const MVMGrapheme32 uc_arg = edge_info[i].arg.uclc.uc;
-                            const MVMGrapheme32 lc_arg = edge_info[i].arg.uclc.lc;
-                            const MVMGrapheme32 ord    = MVM_string_gi_cached_get_grapheme(tc, &gic, offset);
-                            if (ord == lc_arg || ord == uc_arg) {
-                                MVMint64 fate = (edge_info[i].act >> 8) & 0xfffff;
+                            if (g == edge_info[i].arg.uclc.lc || g == edge_info[i].arg.uclc.uc) {
+                                MVMint64 fate = edge_info[i].fate;
                                 nextst[numnext++] = to;
                                 while (usedlonglit <= fate)
                                     longlit[usedlonglit++] = 0;
@@ -706,34 +820,22 @@ static MVMint64 * nqp_nfa_run(MVMThreadContext *tc, MVMNFABody *nfa, MVMString *
                             continue;
                         }
                         case MVM_NFA_EDGE_CODEPOINT_I: {
-                            MVMGrapheme32 uc_arg = edge_info[i].arg.uclc.uc;
-                            MVMGrapheme32 lc_arg = edge_info[i].arg.uclc.lc;
-                            MVMGrapheme32 ord    = MVM_string_gi_cached_get_grapheme(tc, &gic, offset);
-                            if (ord == lc_arg || ord == uc_arg)
+                            if (g == edge_info[i].arg.uclc.lc || g == edge_info[i].arg.uclc.uc)
                                 nextst[numnext++] = to;
                             continue;
                         }
                         case MVM_NFA_EDGE_CODEPOINT_I_NEG: {
-                            const MVMGrapheme32 uc_arg = edge_info[i].arg.uclc.uc;
-                            const MVMGrapheme32 lc_arg = edge_info[i].arg.uclc.lc;
-                            const MVMGrapheme32 ord    = MVM_string_gi_cached_get_grapheme(tc, &gic, offset);
-                            if (ord != lc_arg && ord != uc_arg)
+                            if (g != edge_info[i].arg.uclc.lc && g != edge_info[i].arg.uclc.uc)
                                 nextst[numnext++] = to;
                             continue;
                         }
                         case MVM_NFA_EDGE_CHARRANGE: {
-                            MVMGrapheme32 uc_arg = edge_info[i].arg.uclc.uc;
-                            MVMGrapheme32 lc_arg = edge_info[i].arg.uclc.lc;
-                            MVMGrapheme32 ord    = MVM_string_gi_cached_get_grapheme(tc, &gic, offset);
-                            if (ord >= lc_arg && ord <= uc_arg)
+                            if (g >= edge_info[i].arg.uclc.lc && g <= edge_info[i].arg.uclc.uc)
                                 nextst[numnext++] = to;
                             continue;
                         }
                         case MVM_NFA_EDGE_CHARRANGE_NEG: {
-                            const MVMGrapheme32 uc_arg = edge_info[i].arg.uclc.uc;
-                            const MVMGrapheme32 lc_arg = edge_info[i].arg.uclc.lc;
-                            const MVMGrapheme32 ord    = MVM_string_gi_cached_get_grapheme(tc, &gic, offset);
-                            if (ord < lc_arg || uc_arg < ord)
+                            if (g < edge_info[i].arg.uclc.lc || edge_info[i].arg.uclc.uc < g)
                                 nextst[numnext++] = to;
                             continue;
                         }
@@ -741,71 +843,42 @@ static MVMint64 * nqp_nfa_run(MVMThreadContext *tc, MVMNFABody *nfa, MVMString *
                             if (MVM_UNLIKELY(nfadeb))
                                 fprintf(stderr, "IGNORING SUBRULE\n");
                             continue;
-                        case MVM_NFA_EDGE_CODEPOINT_M:
+                        case MVM_NFA_EDGE_CODEPOINT_M: {
+                            if (MVM_string_ord_basechar_at(tc, target, offset) == edge_info[i].arg.g)
+                                nextst[numnext++] = to;
+                            continue;
+                        }
                         case MVM_NFA_EDGE_CODEPOINT_M_NEG: {
-                            MVMNormalizer norm;
-                            MVMint32 ready;
-                            MVMGrapheme32 ga = edge_info[i].arg.g;
-                            MVMGrapheme32 gb = MVM_string_ord_basechar_at(tc, target, offset);
-
-                            MVM_unicode_normalizer_init(tc, &norm, MVM_NORMALIZE_NFD);
-                            ready = MVM_unicode_normalizer_process_codepoint_to_grapheme(tc, &norm, ga, &ga);
-                            MVM_unicode_normalizer_eof(tc, &norm);
-                            if (!ready)
-                                ga = MVM_unicode_normalizer_get_grapheme(tc, &norm);
-
-                            if (((act == MVM_NFA_EDGE_CODEPOINT_M)     && (ga == gb))
-                             || ((act == MVM_NFA_EDGE_CODEPOINT_M_NEG) && (ga != gb)))
+                            if (MVM_string_ord_basechar_at(tc, target, offset) != edge_info[i].arg.g)
+                                nextst[numnext++] = to;
+                            continue;
+                        }
+                        case MVM_NFA_EDGE_CODEPOINT_IM: {
+                            const MVMGrapheme32 ord = MVM_string_ord_basechar_at(tc, target, offset);
+                            if (ord == edge_info[i].arg.uclc.lc || ord == edge_info[i].arg.uclc.uc)
                                 nextst[numnext++] = to;
-                            MVM_unicode_normalizer_cleanup(tc, &norm);
                             continue;
                         }
-                        case MVM_NFA_EDGE_CODEPOINT_IM:
                         case MVM_NFA_EDGE_CODEPOINT_IM_NEG: {
-                            MVMNormalizer norm;
-                            MVMint32 ready;
-                            MVMGrapheme32 uc_arg = edge_info[i].arg.uclc.uc;
-                            MVMGrapheme32 lc_arg = edge_info[i].arg.uclc.lc;
                             const MVMGrapheme32 ord = MVM_string_ord_basechar_at(tc, target, offset);
-
-                            MVM_unicode_normalizer_init(tc, &norm, MVM_NORMALIZE_NFD);
-                            ready = MVM_unicode_normalizer_process_codepoint_to_grapheme(tc, &norm, uc_arg, &uc_arg);
-                            MVM_unicode_normalizer_eof(tc, &norm);
-                            if (!ready)
-                                uc_arg = MVM_unicode_normalizer_get_grapheme(tc, &norm);
-                            MVM_unicode_normalizer_cleanup(tc, &norm);
-
-                            MVM_unicode_normalizer_init(tc, &norm, MVM_NORMALIZE_NFD);
-                            ready = MVM_unicode_normalizer_process_codepoint_to_grapheme(tc, &norm, lc_arg, &lc_arg);
-                            MVM_unicode_normalizer_eof(tc, &norm);
-                            if (!ready)
-                                lc_arg = MVM_unicode_normalizer_get_grapheme(tc, &norm);
-
-                            if (((act == MVM_NFA_EDGE_CODEPOINT_IM)     && (ord == lc_arg || ord == uc_arg))
-                             || ((act == MVM_NFA_EDGE_CODEPOINT_IM_NEG) && (ord != lc_arg && ord != uc_arg)))
+                            if (ord != edge_info[i].arg.uclc.lc && ord != edge_info[i].arg.uclc.uc)
                                 nextst[numnext++] = to;
-                            MVM_unicode_normalizer_cleanup(tc, &norm);
                             continue;
                         }
                         case MVM_NFA_EDGE_CHARRANGE_M: {
-                            const MVMGrapheme32 uc_arg = edge_info[i].arg.uclc.uc;
-                            const MVMGrapheme32 lc_arg = edge_info[i].arg.uclc.lc;
-                            const MVMGrapheme32 ord    = MVM_string_ord_basechar_at(tc, target, offset);
-                            if (ord >= lc_arg && ord <= uc_arg)
+                            const MVMGrapheme32 ord = MVM_string_ord_basechar_at(tc, target, offset);
+                            if (ord >= edge_info[i].arg.uclc.lc && ord <= edge_info[i].arg.uclc.uc)
                                 nextst[numnext++] = to;
                             continue;
                         }
                         case MVM_NFA_EDGE_CHARRANGE_M_NEG: {
-                            const MVMGrapheme32 uc_arg = edge_info[i].arg.uclc.uc;
-                            const MVMGrapheme32 lc_arg = edge_info[i].arg.uclc.lc;
-                            const MVMGrapheme32 ord    = MVM_string_ord_basechar_at(tc, target, offset);
-                            if (ord < lc_arg || uc_arg < ord)
+                            const MVMGrapheme32 ord = MVM_string_ord_basechar_at(tc, target, offset);
+                            if (ord < edge_info[i].arg.uclc.lc || edge_info[i].arg.uclc.uc < ord)
                                 nextst[numnext++] = to;
                             continue;
                         }
                         case MVM_NFA_EDGE_SYNTH_CP_COUNT: {
                             /* Binary search the edges ahead for the grapheme. */
-                            const MVMGrapheme32 search = MVM_string_gi_cached_get_grapheme(tc, &gic, offset);
                             const MVMint64 num_possibilities = edge_info[i].arg.i;
                             const MVMint64 end = i + num_possibilities;
                             MVMint64 l = i + 1;
@@ -814,46 +887,37 @@ static MVMint64 * nqp_nfa_run(MVMThreadContext *tc, MVMNFABody *nfa, MVMString *
                             while (l <= r) {
                                 const MVMint64 m = l + (r - l) / 2;
                                 const MVMGrapheme32 test = edge_info[m].arg.g;
-                                if (test == search) {
+                                if (test == g) {
                                     /* We found it, but important we get the first edge
                                      * that matches. */
                                     found = m;
-                                    while (found > i + 1 && edge_info[found - 1].arg.g == search)
+                                    while (found > i + 1 && edge_info[found - 1].arg.g == g)
                                         found--;
                                     break;
                                 }
-                                if (test < search)
+                                if (test < g)
                                     l = m + 1;
                                 else
                                     r = m - 1;
                             }
-                            if (found == -1) {
-                                /* Binary search failed to find a match, so just skip all
-                                 * the nodes. */
-                                i += num_possibilities;
-                            }
-                            else {
+                            if (found != -1) {
                                 /* Add all states that match. */
-                                while (found <= end && edge_info[found].arg.g == search) {
+                                while (found <= end && edge_info[found].arg.g == g) {
                                     to = edge_info[found].to;
-                                    if (edge_info[found].act == MVM_NFA_EDGE_CODEPOINT) {
-                                        nextst[numnext++] = to;
-                                        if (MVM_UNLIKELY(nfadeb))
-                                            fprintf(stderr, "%d->%d ", (int)found, (int)to);
-                                    }
-                                    else {
-                                        const MVMint64 fate = (edge_info[found].act >> 8) & 0xfffff;
-                                        nextst[numnext++] = to;
+                                    nextst[numnext++] = to;
+                                    if (edge_info[found].act == MVM_NFA_EDGE_CODEPOINT_LL) {
+                                        const MVMint64 fate = edge_info[found].fate;
                                         while (usedlonglit <= fate)
                                             longlit[usedlonglit++] = 0;
                                         longlit[fate] = offset - orig_offset + 1;
-                                        if (MVM_UNLIKELY(nfadeb))
-                                            fprintf(stderr, "%d->%d ", (int)found, (int)to);
                                     }
+                                    if (MVM_UNLIKELY(nfadeb))
+                                        fprintf(stderr, "%d->%d ", (int)found, (int)to);
                                     found++;
                                 }
-                                i += num_possibilities;
                             }
+                            /* Either way, skip over the codepoint edges. */
+                            i += num_possibilities;
                             break;
                         }
                     }
@@ -862,9 +926,8 @@ static MVMint64 * nqp_nfa_run(MVMThreadContext *tc, MVMNFABody *nfa, MVMString *
             if (MVM_UNLIKELY(nfadeb)) fprintf(stderr,"\n");
         }
 
-        /* Move to next character and generation. */
+        /* Move to next character. */
         offset++;
-        gen++;
     }
     /* strip any literal lengths, leaving only fates */
     if (usedlonglit || nfadeb) {
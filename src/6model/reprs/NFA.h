@@ -32,6 +32,10 @@
  * is especially useful in huge categories, such as infix, prefix, etc. */
 #define MVM_NFA_EDGE_SYNTH_CP_COUNT    64
 
+/* Used in the compiled form of the NFA for edges that the evaluator would
+ * never follow (for example, ones with an unknown act). */
+#define MVM_NFA_EDGE_SYNTH_NOOP        65
+
 /* State entry. */
 struct MVMNFAStateInfo {
     MVMint64 act;
@@ -47,12 +51,42 @@ struct MVMNFAStateInfo {
     } arg;
 };
 
+/* An edge in the compiled form of an NFA. The act has any literal fate
+ * stripped off (it lives in fate instead), and the arguments of the edges
+ * matching on base characters are already normalized. Charlist edges point
+ * back at the original edge, since that is where the GC keeps the string
+ * up to date. */
+struct MVMNFACompiledEdge {
+    MVMint32 act;
+    MVMint32 to;
+    MVMint32 fate;
+    union {
+        MVMGrapheme32    g;
+        MVMint64         i;
+        MVMNFAStateInfo *orig;
+        struct {
+            MVMGrapheme32 uc;
+            MVMGrapheme32 lc;
+        } uclc;
+    } arg;
+};
+
+/* The compiled form of an NFA: all of the edges flattened into a single
+ * array, with the edges of state s (1-based) living between edge_start[s - 1]
+ * and edge_start[s]. Built lazily on first run and then immutable. */
+struct MVMNFACompiled {
+    MVMint64           *edge_start;
+    MVMNFACompiledEdge *edges;
+    MVMint64            num_edges;
+};
+
 /* Body of an NFA. */
 struct MVMNFABody {
     MVMObject        *fates;
     MVMint64          num_states;
     MVMint64         *num_state_edges;
     MVMNFAStateInfo **states;
+    MVMNFACompiled   *compiled;
 };
 
 struct MVMNFA {
@@ -1,4 +1,5 @@
 #include "moar.h"
+#include "platform/mmap.h"
 #include "limits.h"
 
 /* This representation's function pointer table. */
@@ -103,7 +104,14 @@ static void VMArray_gc_mark(MVMThreadContext *tc, MVMSTable *st, void *data, MVM
 /* Called by the VM in order to free memory associated with this object. */
 static void gc_free(MVMThreadContext *tc, MVMObject *obj) {
     MVMArray *arr = (MVMArray *)obj;
-    MVM_free(arr->body.slots.any);
+    if (obj->header.flags1 & MVM_CF_MAPPED_MEMORY) {
+        MVMArrayREPRData *repr_data = (MVMArrayREPRData *)STABLE(obj)->REPR_data;
+        MVM_platform_unmap_file(arr->body.slots.any, NULL,
+            (size_t)(arr->body.ssize * repr_data->elem_size));
+    }
+    else {
+        MVM_free(arr->body.slots.any);
+    }
 }
 
 /* Marks the representation data in an STable.*/
@@ -300,7 +308,7 @@ static MVMuint64 zero_slots(MVMThreadContext *tc, MVMArrayBody *body,
     return elems;
 }
 
-static void set_size_internal(MVMThreadContext *tc, MVMArrayBody *body, MVMuint64 n, MVMArrayREPRData *repr_data) {
+static void set_size_internal(MVMThreadContext *tc, MVMObject *root, MVMArrayBody *body, MVMuint64 n, MVMArrayREPRData *repr_data) {
     MVMuint64   elems = body->elems;
     MVMuint64   start = body->start;
     MVMuint64   ssize = body->ssize;
@@ -359,10 +367,20 @@ static void set_size_internal(MVMThreadContext *tc, MVMArrayBody *body, MVMuint6
                 ssize);
     }
 
-    /* now allocate the new slot buffer */
-    slots = (slots)
-            ? MVM_realloc(slots, ssize * repr_data->elem_size)
-            : MVM_malloc(ssize * repr_data->elem_size);
+    /* now allocate the new slot buffer; slots that are a file mapping can't
+     * be reallocated, so get copied onto the heap instead */
+    if (slots && (root->header.flags1 & MVM_CF_MAPPED_MEMORY)) {
+        void *mapped = slots;
+        slots = MVM_malloc(ssize * repr_data->elem_size);
+        memcpy(slots, mapped, body->ssize * repr_data->elem_size);
+        MVM_platform_unmap_file(mapped, NULL, (size_t)(body->ssize * repr_data->elem_size));
+        root->header.flags1 &= ~MVM_CF_MAPPED_MEMORY;
+    }
+    else {
+        slots = (slots)
+                ? MVM_realloc(slots, ssize * repr_data->elem_size)
+                : MVM_malloc(ssize * repr_data->elem_size);
+    }
 
     /* fill out any unused slots with NULL pointers or zero values */
     body->slots.any = slots;
@@ -386,7 +404,7 @@ void MVM_VMArray_bind_pos(MVMThreadContext *tc, MVMSTable *st, MVMObject *root,
             MVM_exception_throw_adhoc(tc, "MVMArray: Index out of bounds");
     }
     else if ((MVMuint64)index >= body->elems)
-        set_size_internal(tc, body, (MVMuint64)index + 1, repr_data);
+        set_size_internal(tc, root, body, (MVMuint64)index + 1, repr_data);
 
     real_index = (MVMuint64)index;
 
@@ -467,7 +485,7 @@ static void set_elems(MVMThreadContext *tc, MVMSTable *st, MVMObject *root, void
     MVMArrayREPRData *repr_data = (MVMArrayREPRData *)st->REPR_data;
     MVMArrayBody     *body      = (MVMArrayBody *)data;
     enter_single_user(tc, body);
-    set_size_internal(tc, body, count, repr_data);
+    set_size_internal(tc, root, body, count, repr_data);
     exit_single_user(tc, body);
 }
 
@@ -475,7 +493,7 @@ void MVM_VMArray_push(MVMThreadContext *tc, MVMSTable *st, MVMObject *root, void
     MVMArrayBody     *body      = (MVMArrayBody *)data;
     MVMArrayREPRData *repr_data = (MVMArrayREPRData *)st->REPR_data;
     enter_single_user(tc, body);
-    set_size_internal(tc, body, body->elems + 1, repr_data);
+    set_size_internal(tc, root, body, body->elems + 1, repr_data);
     switch (repr_data->slot_type) {
         case MVM_ARRAY_OBJ:
             if (kind != MVM_reg_obj)
@@ -634,7 +652,7 @@ static void unshift(MVMThreadContext *tc, MVMSTable *st, MVMObject *root, void *
         MVMuint64 elems = body->elems;
 
         /* grow the array */
-        set_size_internal(tc, body, elems + n, repr_data);
+        set_size_internal(tc, root, body, elems + n, repr_data);
 
         /* move elements and set start */
         memmove(
@@ -874,7 +892,7 @@ static void aslice(MVMThreadContext *tc, MVMSTable *st, MVMObject *src, void *da
 
     elems = end - start + 1;
     if (d_repr_data) {
-        set_size_internal(tc, d_body, elems, d_repr_data);
+        set_size_internal(tc, dest, d_body, elems, d_repr_data);
     }
 
     copy_elements(tc, src, dest, start, 0, elems);
@@ -893,7 +911,7 @@ static void write_buf(MVMThreadContext *tc, MVMSTable *st, MVMObject *root, void
 
     /* resize the array if necessary*/
     if (elems < offset + count)
-        set_size_internal(tc, body, offset + count, repr_data);
+        set_size_internal(tc, root, body, offset + count, repr_data);
 
     memcpy(body->slots.u8 + (start + offset) * repr_data->elem_size, from, count);
 }
@@ -984,7 +1002,7 @@ static void asplice(MVMThreadContext *tc, MVMSTable *st, MVMObject *root, void *
     }
 
     /* now resize the array */
-    set_size_internal(tc, body, offset + elems1 + tail, repr_data);
+    set_size_internal(tc, root, body, offset + elems1 + tail, repr_data);
 
     start = body->start;
     if (tail > 0 && count < elems1) {
@@ -1426,7 +1444,7 @@ const MVMREPROps * MVMArray_initialize(MVMThreadContext *tc) {
 
 /* devirtualized versions of bind_pos */
 
-static void vmarray_bind_pos_int64(MVMThreadContext *tc, MVMSTable *st, void *data, MVMint64 index, MVMRegister value) {
+static void vmarray_bind_pos_int64(MVMThreadContext *tc, MVMSTable *st, MVMObject *root, void *data, MVMint64 index, MVMRegister value) {
     MVMArrayBody     *body      = (MVMArrayBody *)data;
     MVMuint64        real_index;
 
@@ -1439,7 +1457,7 @@ static void vmarray_bind_pos_int64(MVMThreadContext *tc, MVMSTable *st, void *da
     }
     else if ((MVMuint64)index >= body->elems) {
         MVMArrayREPRData *repr_data = (MVMArrayREPRData *)st->REPR_data;
-        set_size_internal(tc, body, (MVMuint64)index + 1, repr_data);
+        set_size_internal(tc, root, body, (MVMuint64)index + 1, repr_data);
     }
 
     real_index = (MVMuint64)index;
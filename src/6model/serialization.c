@@ -1538,7 +1538,7 @@ MVM_NO_RETURN static void fail_deserialize(MVMThreadContext *tc, char **waste, M
 static MVMString * read_string_from_heap(MVMThreadContext *tc, MVMSerializationReader *reader, MVMuint32 idx) {
     if (reader->root.string_heap) {
         if (idx < MVM_repr_elems(tc, reader->root.string_heap))
-            return MVM_repr_at_pos_s(tc, reader->root.string_heap, idx);
+            return MVM_string_intern(tc, MVM_repr_at_pos_s(tc, reader->root.string_heap, idx));
         else
             fail_deserialize(tc, NULL, reader,
                 "Attempt to read past end of string heap (index %d)", idx);
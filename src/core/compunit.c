@@ -236,6 +236,7 @@ MVMString * MVM_cu_obtain_string(MVMThreadContext *tc, MVMCompUnit *cu, MVMuint3
             s = decode_utf8
                 ? MVM_string_utf8_decode(tc, tc->instance->VMString, (char *)cur_pos, bytes)
                 : MVM_string_latin1_decode(tc, tc->instance->VMString, (char *)cur_pos, bytes);
+            s = MVM_string_intern(tc, s);
             MVM_ASSIGN_REF(tc, &(cu->common.header), cu->body.strings[idx], s);
             MVM_gc_allocate_gen2_default_clear(tc);
             return s;
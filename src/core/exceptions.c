@@ -957,9 +957,11 @@ MVM_NO_RETURN void MVM_exception_throw_adhoc_free_va(MVMThreadContext *tc, char
     run_handler(tc, lh, (MVMObject *)ex, MVM_EX_CAT_CATCH, NULL);
 
     /* Clear any C stack temporaries that code may have pushed before throwing
-     * the exception, and release any needed mutex. */
+     * the exception, release any needed mutex, and free any pieces of a
+     * vectored write. */
     MVM_gc_root_temp_pop_all(tc);
     MVM_tc_release_ex_release_mutex(tc);
+    MVM_tc_free_ex_free_vec_pieces(tc);
 
     /* Jump back into the interpreter. */
     longjmp(tc->interp_jump, 1);
@@ -245,6 +245,12 @@ struct MVMInstance {
     MVMuint32                     all_scs_alloc;
     uv_mutex_t                    mutex_sc_registry;
 
+    /* Table of interned strings (see strings/intern.c), which is weak, and
+     * whether interning is enabled at all. */
+    MVMStrHashTable string_interns;
+    uv_mutex_t      mutex_string_interns;
+    MVMuint8        string_interning;
+
     /* Mutex to serialize additions of type parameterizations. Global rather
      * than per STable, as this doesn't happen often. */
     uv_mutex_t mutex_parameterization_add;
@@ -334,19 +340,15 @@ struct MVMInstance {
      * I/O and process state
      ************************************************************************/
 
-    /* The event loop thread, a mutex to avoid start-races, a concurrent
-     * queue of tasks that need to be processed by the event loop thread
-     * and an array of active tasks, for the purpose of keeping them GC
-     * marked. */
-    MVMObject        *event_loop_thread;
-    uv_loop_t        *event_loop;
+    /* The event loops (each with its thread, queues of work and active
+     * tasks), how many of them there are, the counter used to hand out
+     * work to them round-robin, a flag set once all of them are running,
+     * and a mutex to avoid start-races. */
+    MVMIOEventLoop   *event_loops;
+    MVMuint32         num_event_loops;
+    AO_t              event_loop_next;
+    AO_t              event_loops_started;
     uv_mutex_t        mutex_event_loop;
-    MVMObject        *event_loop_todo_queue;
-    MVMObject        *event_loop_permit_queue;
-    MVMObject        *event_loop_cancel_queue;
-    MVMObject        *event_loop_active;
-    MVMObject        *event_loop_free_indices;
-    uv_async_t       *event_loop_wakeup;
 
     /* Standard file handles. */
     MVMObject *stdin_handle;
@@ -404,6 +406,18 @@ struct MVMInstance {
     /* Normal Form Grapheme state (synthetics table, lookup, etc.). */
     MVMNFGState *nfg;
 
+    /* Character classes of the BMP codepoints, in blocks of 256 that are
+     * computed the first time they are needed; each entry holds the
+     * MVM_CCLASS_* bits of that codepoint. Along with the first block, we
+     * also work out for each class (by bit number) the 8-bit graphemes that
+     * a scan for members (1) or non-members (0) should stop at. */
+    MVMuint16 *cclass_blocks[256];
+    MVMuint8   cclass_8bit_stops[14][2][32];
+
+    /* Case changes of the 8-bit graphemes, by MVM_unicode_case_change_type_*,
+     * computed the first time each is needed (see do_case_change). */
+    MVMuint8 *case_change_8bit[4];
+
     /************************************************************************
      * Type objects for built-in types and special values
      ************************************************************************/
@@ -535,6 +549,11 @@ struct MVMInstance {
      * service type attacks. */
     MVMuint64 hashSecrets[2];
 
+    /* Whether string hash codes are computed with SipHash-2-4 rather than
+     * the default SipHash-1-3. Picked once at startup (MVM_STRING_HASH), as
+     * cached hash codes must agree for the lifetime of the instance. */
+    MVMuint8 string_hash_siphash24;
+
     /************************************************************************
      * VM Event subscription
      ************************************************************************/
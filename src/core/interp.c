@@ -5729,6 +5729,68 @@ void MVM_interp_run(MVMThreadContext *tc, void (*initial_invoke)(MVMThreadContex
                 cur_op += 2;
                 goto NEXT;
             }
+            OP(unicollkey_s):
+                GET_REG(cur_op, 0).o = MVM_unicode_string_collation_key(tc,
+                    GET_REG(cur_op, 2).s,   GET_REG(cur_op,  4).i64,
+                    GET_REG(cur_op, 6).i64, GET_REG(cur_op,  8).i64,
+                    GET_REG(cur_op, 10).o);
+                cur_op += 12;
+                goto NEXT;
+            OP(eventloopstats):
+                GET_REG(cur_op, 0).o = MVM_io_eventloop_stats(tc);
+                cur_op += 2;
+                goto NEXT;
+            OP(asynclistenshared):
+                GET_REG(cur_op, 0).o = MVM_io_socket_listen_shared_async(tc,
+                    GET_REG(cur_op, 2).o, GET_REG(cur_op, 4).o, GET_REG(cur_op, 6).s,
+                    GET_REG(cur_op, 8).i64, (MVMint32)GET_REG(cur_op, 10).i64, GET_REG(cur_op, 12).o);
+                cur_op += 14;
+                goto NEXT;
+            OP(asyncsendfile):
+                GET_REG(cur_op, 0).o = MVM_io_socket_sendfile_async(tc,
+                    GET_REG(cur_op, 2).o, GET_REG(cur_op, 4).o, GET_REG(cur_op, 6).o,
+                    GET_REG(cur_op, 8).o, GET_REG(cur_op, 10).i64, GET_REG(cur_op, 12).i64,
+                    GET_REG(cur_op, 14).o);
+                cur_op += 16;
+                goto NEXT;
+            OP(mapfile):
+                GET_REG(cur_op, 0).o = MVM_file_map(tc, GET_REG(cur_op, 2).s,
+                    GET_REG(cur_op, 4).i64, GET_REG(cur_op, 6).i64, GET_REG(cur_op, 8).o);
+                cur_op += 10;
+                goto NEXT;
+            OP(write_fhbv):
+                MVM_io_write_bytes_v(tc, GET_REG(cur_op, 0).o, GET_REG(cur_op, 2).o);
+                cur_op += 4;
+                goto NEXT;
+            OP(asyncwritebytesv):
+                GET_REG(cur_op, 0).o = MVM_io_write_bytes_v_async(tc, GET_REG(cur_op, 2).o,
+                    GET_REG(cur_op, 4).o, GET_REG(cur_op, 6).o, GET_REG(cur_op, 8).o,
+                    GET_REG(cur_op, 10).o);
+                cur_op += 12;
+                goto NEXT;
+            OP(asyncudpreadbatch):
+                GET_REG(cur_op, 0).o = MVM_io_socket_udp_read_batch_async(tc, GET_REG(cur_op, 2).o,
+                    GET_REG(cur_op, 4).o, GET_REG(cur_op, 6).o, GET_REG(cur_op, 8).o,
+                    GET_REG(cur_op, 10).o);
+                cur_op += 12;
+                goto NEXT;
+            OP(asyncudpwritebatch):
+                GET_REG(cur_op, 0).o = MVM_io_socket_udp_write_batch_async(tc, GET_REG(cur_op, 2).o,
+                    GET_REG(cur_op, 4).o, GET_REG(cur_op, 6).o, GET_REG(cur_op, 8).o,
+                    GET_REG(cur_op, 10).o);
+                cur_op += 12;
+                goto NEXT;
+            OP(asyncopenfile):
+                GET_REG(cur_op, 0).o = MVM_io_file_open_async(tc, GET_REG(cur_op, 2).o,
+                    GET_REG(cur_op, 4).o, GET_REG(cur_op, 6).s, GET_REG(cur_op, 8).s,
+                    GET_REG(cur_op, 10).o);
+                cur_op += 12;
+                goto NEXT;
+            OP(asyncfsync):
+                GET_REG(cur_op, 0).o = MVM_io_file_fsync_async(tc, GET_REG(cur_op, 2).o,
+                    GET_REG(cur_op, 4).o, GET_REG(cur_op, 6).o, GET_REG(cur_op, 8).o);
+                cur_op += 10;
+                goto NEXT;
             OP(sp_guard): {
                 MVMRegister *target = &GET_REG(cur_op, 0);
                 MVMObject *check = GET_REG(cur_op, 2).o;
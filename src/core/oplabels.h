@@ -826,6 +826,17 @@ static const void * const LABELS[] = {
     &&OP_totalmem,
     &&OP_nextdispatcherfor,
     &&OP_takenextdispatcher,
+    &&OP_unicollkey_s,
+    &&OP_eventloopstats,
+    &&OP_asynclistenshared,
+    &&OP_asyncsendfile,
+    &&OP_mapfile,
+    &&OP_write_fhbv,
+    &&OP_asyncwritebytesv,
+    &&OP_asyncudpreadbatch,
+    &&OP_asyncudpwritebatch,
+    &&OP_asyncopenfile,
+    &&OP_asyncfsync,
     &&OP_sp_guard,
     &&OP_sp_guardconc,
     &&OP_sp_guardtype,
@@ -1014,17 +1025,6 @@ static const void * const LABELS[] = {
     NULL,
     NULL,
     NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
     &&OP_CALL_EXTOP,
     &&OP_CALL_EXTOP,
     &&OP_CALL_EXTOP,
@@ -826,103 +826,114 @@
 #define MVM_OP_totalmem 822
 #define MVM_OP_nextdispatcherfor 823
 #define MVM_OP_takenextdispatcher 824
-#define MVM_OP_sp_guard 825
-#define MVM_OP_sp_guardconc 826
-#define MVM_OP_sp_guardtype 827
-#define MVM_OP_sp_guardsf 828
-#define MVM_OP_sp_guardsfouter 829
-#define MVM_OP_sp_guardobj 830
-#define MVM_OP_sp_guardnotobj 831
-#define MVM_OP_sp_guardjustconc 832
-#define MVM_OP_sp_guardjusttype 833
-#define MVM_OP_sp_rebless 834
-#define MVM_OP_sp_resolvecode 835
-#define MVM_OP_sp_decont 836
-#define MVM_OP_sp_getlex_o 837
-#define MVM_OP_sp_getlex_ins 838
-#define MVM_OP_sp_getlex_no 839
-#define MVM_OP_sp_bindlex_in 840
-#define MVM_OP_sp_bindlex_os 841
-#define MVM_OP_sp_getarg_o 842
-#define MVM_OP_sp_getarg_i 843
-#define MVM_OP_sp_getarg_n 844
-#define MVM_OP_sp_getarg_s 845
-#define MVM_OP_sp_fastinvoke_v 846
-#define MVM_OP_sp_fastinvoke_i 847
-#define MVM_OP_sp_fastinvoke_n 848
-#define MVM_OP_sp_fastinvoke_s 849
-#define MVM_OP_sp_fastinvoke_o 850
-#define MVM_OP_sp_speshresolve 851
-#define MVM_OP_sp_paramnamesused 852
-#define MVM_OP_sp_getspeshslot 853
-#define MVM_OP_sp_findmeth 854
-#define MVM_OP_sp_fastcreate 855
-#define MVM_OP_sp_get_o 856
-#define MVM_OP_sp_get_i64 857
-#define MVM_OP_sp_get_i32 858
-#define MVM_OP_sp_get_i16 859
-#define MVM_OP_sp_get_i8 860
-#define MVM_OP_sp_get_n 861
-#define MVM_OP_sp_get_s 862
-#define MVM_OP_sp_bind_o 863
-#define MVM_OP_sp_bind_i64 864
-#define MVM_OP_sp_bind_i32 865
-#define MVM_OP_sp_bind_i16 866
-#define MVM_OP_sp_bind_i8 867
-#define MVM_OP_sp_bind_n 868
-#define MVM_OP_sp_bind_s 869
-#define MVM_OP_sp_bind_s_nowb 870
-#define MVM_OP_sp_p6oget_o 871
-#define MVM_OP_sp_p6ogetvt_o 872
-#define MVM_OP_sp_p6ogetvc_o 873
-#define MVM_OP_sp_p6oget_i 874
-#define MVM_OP_sp_p6oget_n 875
-#define MVM_OP_sp_p6oget_s 876
-#define MVM_OP_sp_p6oget_bi 877
-#define MVM_OP_sp_p6obind_o 878
-#define MVM_OP_sp_p6obind_i 879
-#define MVM_OP_sp_p6obind_n 880
-#define MVM_OP_sp_p6obind_s 881
-#define MVM_OP_sp_p6oget_i32 882
-#define MVM_OP_sp_p6obind_i32 883
-#define MVM_OP_sp_getvt_o 884
-#define MVM_OP_sp_getvc_o 885
-#define MVM_OP_sp_fastbox_i 886
-#define MVM_OP_sp_fastbox_bi 887
-#define MVM_OP_sp_fastbox_i_ic 888
-#define MVM_OP_sp_fastbox_bi_ic 889
-#define MVM_OP_sp_deref_get_i64 890
-#define MVM_OP_sp_deref_get_n 891
-#define MVM_OP_sp_deref_bind_i64 892
-#define MVM_OP_sp_deref_bind_n 893
-#define MVM_OP_sp_getlexvia_o 894
-#define MVM_OP_sp_getlexvia_ins 895
-#define MVM_OP_sp_bindlexvia_os 896
-#define MVM_OP_sp_bindlexvia_in 897
-#define MVM_OP_sp_getstringfrom 898
-#define MVM_OP_sp_getwvalfrom 899
-#define MVM_OP_sp_jit_enter 900
-#define MVM_OP_sp_istrue_n 901
-#define MVM_OP_sp_boolify_iter 902
-#define MVM_OP_sp_boolify_iter_arr 903
-#define MVM_OP_sp_boolify_iter_hash 904
-#define MVM_OP_sp_cas_o 905
-#define MVM_OP_sp_atomicload_o 906
-#define MVM_OP_sp_atomicstore_o 907
-#define MVM_OP_sp_add_I 908
-#define MVM_OP_sp_sub_I 909
-#define MVM_OP_sp_mul_I 910
-#define MVM_OP_sp_bool_I 911
-#define MVM_OP_prof_enter 912
-#define MVM_OP_prof_enterspesh 913
-#define MVM_OP_prof_enterinline 914
-#define MVM_OP_prof_enternative 915
-#define MVM_OP_prof_exit 916
-#define MVM_OP_prof_allocated 917
-#define MVM_OP_prof_replaced 918
-#define MVM_OP_ctw_check 919
-#define MVM_OP_coverage_log 920
-#define MVM_OP_breakpoint 921
+#define MVM_OP_unicollkey_s 825
+#define MVM_OP_eventloopstats 826
+#define MVM_OP_asynclistenshared 827
+#define MVM_OP_asyncsendfile 828
+#define MVM_OP_mapfile 829
+#define MVM_OP_write_fhbv 830
+#define MVM_OP_asyncwritebytesv 831
+#define MVM_OP_asyncudpreadbatch 832
+#define MVM_OP_asyncudpwritebatch 833
+#define MVM_OP_asyncopenfile 834
+#define MVM_OP_asyncfsync 835
+#define MVM_OP_sp_guard 836
+#define MVM_OP_sp_guardconc 837
+#define MVM_OP_sp_guardtype 838
+#define MVM_OP_sp_guardsf 839
+#define MVM_OP_sp_guardsfouter 840
+#define MVM_OP_sp_guardobj 841
+#define MVM_OP_sp_guardnotobj 842
+#define MVM_OP_sp_guardjustconc 843
+#define MVM_OP_sp_guardjusttype 844
+#define MVM_OP_sp_rebless 845
+#define MVM_OP_sp_resolvecode 846
+#define MVM_OP_sp_decont 847
+#define MVM_OP_sp_getlex_o 848
+#define MVM_OP_sp_getlex_ins 849
+#define MVM_OP_sp_getlex_no 850
+#define MVM_OP_sp_bindlex_in 851
+#define MVM_OP_sp_bindlex_os 852
+#define MVM_OP_sp_getarg_o 853
+#define MVM_OP_sp_getarg_i 854
+#define MVM_OP_sp_getarg_n 855
+#define MVM_OP_sp_getarg_s 856
+#define MVM_OP_sp_fastinvoke_v 857
+#define MVM_OP_sp_fastinvoke_i 858
+#define MVM_OP_sp_fastinvoke_n 859
+#define MVM_OP_sp_fastinvoke_s 860
+#define MVM_OP_sp_fastinvoke_o 861
+#define MVM_OP_sp_speshresolve 862
+#define MVM_OP_sp_paramnamesused 863
+#define MVM_OP_sp_getspeshslot 864
+#define MVM_OP_sp_findmeth 865
+#define MVM_OP_sp_fastcreate 866
+#define MVM_OP_sp_get_o 867
+#define MVM_OP_sp_get_i64 868
+#define MVM_OP_sp_get_i32 869
+#define MVM_OP_sp_get_i16 870
+#define MVM_OP_sp_get_i8 871
+#define MVM_OP_sp_get_n 872
+#define MVM_OP_sp_get_s 873
+#define MVM_OP_sp_bind_o 874
+#define MVM_OP_sp_bind_i64 875
+#define MVM_OP_sp_bind_i32 876
+#define MVM_OP_sp_bind_i16 877
+#define MVM_OP_sp_bind_i8 878
+#define MVM_OP_sp_bind_n 879
+#define MVM_OP_sp_bind_s 880
+#define MVM_OP_sp_bind_s_nowb 881
+#define MVM_OP_sp_p6oget_o 882
+#define MVM_OP_sp_p6ogetvt_o 883
+#define MVM_OP_sp_p6ogetvc_o 884
+#define MVM_OP_sp_p6oget_i 885
+#define MVM_OP_sp_p6oget_n 886
+#define MVM_OP_sp_p6oget_s 887
+#define MVM_OP_sp_p6oget_bi 888
+#define MVM_OP_sp_p6obind_o 889
+#define MVM_OP_sp_p6obind_i 890
+#define MVM_OP_sp_p6obind_n 891
+#define MVM_OP_sp_p6obind_s 892
+#define MVM_OP_sp_p6oget_i32 893
+#define MVM_OP_sp_p6obind_i32 894
+#define MVM_OP_sp_getvt_o 895
+#define MVM_OP_sp_getvc_o 896
+#define MVM_OP_sp_fastbox_i 897
+#define MVM_OP_sp_fastbox_bi 898
+#define MVM_OP_sp_fastbox_i_ic 899
+#define MVM_OP_sp_fastbox_bi_ic 900
+#define MVM_OP_sp_deref_get_i64 901
+#define MVM_OP_sp_deref_get_n 902
+#define MVM_OP_sp_deref_bind_i64 903
+#define MVM_OP_sp_deref_bind_n 904
+#define MVM_OP_sp_getlexvia_o 905
+#define MVM_OP_sp_getlexvia_ins 906
+#define MVM_OP_sp_bindlexvia_os 907
+#define MVM_OP_sp_bindlexvia_in 908
+#define MVM_OP_sp_getstringfrom 909
+#define MVM_OP_sp_getwvalfrom 910
+#define MVM_OP_sp_jit_enter 911
+#define MVM_OP_sp_istrue_n 912
+#define MVM_OP_sp_boolify_iter 913
+#define MVM_OP_sp_boolify_iter_arr 914
+#define MVM_OP_sp_boolify_iter_hash 915
+#define MVM_OP_sp_cas_o 916
+#define MVM_OP_sp_atomicload_o 917
+#define MVM_OP_sp_atomicstore_o 918
+#define MVM_OP_sp_add_I 919
+#define MVM_OP_sp_sub_I 920
+#define MVM_OP_sp_mul_I 921
+#define MVM_OP_sp_bool_I 922
+#define MVM_OP_prof_enter 923
+#define MVM_OP_prof_enterspesh 924
+#define MVM_OP_prof_enterinline 925
+#define MVM_OP_prof_enternative 926
+#define MVM_OP_prof_exit 927
+#define MVM_OP_prof_allocated 928
+#define MVM_OP_prof_replaced 929
+#define MVM_OP_ctw_check 930
+#define MVM_OP_coverage_log 931
+#define MVM_OP_breakpoint 932
 
 #define MVM_OP_EXT_BASE 1024
 #define MVM_OP_EXT_CU_LIMIT 1024
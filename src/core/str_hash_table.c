@@ -177,7 +177,8 @@ MVM_STATIC_INLINE struct MVMStrHashHandle *hash_insert_internal(MVMThreadContext
         if (*metadata == probe_distance) {
             struct MVMStrHashHandle *entry = (struct MVMStrHashHandle *) entry_raw;
             if (entry->key == key
-                || (MVM_string_graphs_nocheck(tc, key) == MVM_string_graphs_nocheck(tc, entry->key)
+                || (!MVM_string_both_interned(key, entry->key)
+                    && MVM_string_graphs_nocheck(tc, key) == MVM_string_graphs_nocheck(tc, entry->key)
                     && MVM_string_substrings_equal_nocheck(tc, key, 0,
                                                            MVM_string_graphs_nocheck(tc, key),
                                                            entry->key, 0))) {
@@ -283,7 +284,8 @@ void MVM_str_hash_delete_nocheck(MVMThreadContext *tc,
         if (*metadata == probe_distance) {
             struct MVMStrHashHandle *entry = (struct MVMStrHashHandle *) entry_raw;
             if (entry->key == key
-                || (MVM_string_graphs_nocheck(tc, key) == MVM_string_graphs_nocheck(tc, entry->key)
+                || (!MVM_string_both_interned(key, entry->key)
+                    && MVM_string_graphs_nocheck(tc, key) == MVM_string_graphs_nocheck(tc, entry->key)
                     && MVM_string_substrings_equal_nocheck(tc, key, 0,
                                                            MVM_string_graphs_nocheck(tc, key),
                                                            entry->key, 0))) {
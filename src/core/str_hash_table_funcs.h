@@ -63,7 +63,8 @@ MVM_STATIC_INLINE void *MVM_str_hash_fetch_nocheck(MVMThreadContext *tc,
         if (*metadata == probe_distance) {
             struct MVMStrHashHandle *entry = (struct MVMStrHashHandle *) entry_raw;
             if (entry->key == key
-                || (MVM_string_graphs_nocheck(tc, key) == MVM_string_graphs_nocheck(tc, entry->key)
+                || (!MVM_string_both_interned(key, entry->key)
+                    && MVM_string_graphs_nocheck(tc, key) == MVM_string_graphs_nocheck(tc, entry->key)
                     && MVM_string_substrings_equal_nocheck(tc, key, 0,
                                                            MVM_string_graphs_nocheck(tc, key),
                                                            entry->key, 0))) {
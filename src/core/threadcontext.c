@@ -119,6 +119,9 @@ void MVM_tc_destroy(MVMThreadContext *tc) {
     MVM_free(tc->gen2roots);
     MVM_free(tc->finalize);
 
+    /* Free the NFG synthetics cache. */
+    MVM_free(tc->nfg_cache);
+
     /* Free any memory allocated for NFAs and multi-dim indices. */
     MVM_free(tc->nfa_done);
     MVM_free(tc->nfa_curst);
@@ -164,3 +167,22 @@ void MVM_tc_release_ex_release_mutex(MVMThreadContext *tc) {
 void MVM_tc_clear_ex_release_mutex(MVMThreadContext *tc) {
     tc->ex_release_mutex = NULL;
 }
+
+/* Setting and clearing the pieces of a vectored write to free on exception
+ * throw. */
+void MVM_tc_set_ex_free_vec_pieces(MVMThreadContext *tc, MVMIOVecPiece *pieces, MVMuint32 count) {
+    if (tc->ex_free_vec_pieces)
+        MVM_exception_throw_adhoc(tc, "Internal error: multiple ex_free_vec_pieces");
+    tc->ex_free_vec_pieces = pieces;
+    tc->ex_free_vec_count  = count;
+}
+void MVM_tc_free_ex_free_vec_pieces(MVMThreadContext *tc) {
+    if (tc->ex_free_vec_pieces)
+        MVM_io_vec_pieces_free(tc, tc->ex_free_vec_pieces, tc->ex_free_vec_count);
+    tc->ex_free_vec_pieces = NULL;
+    tc->ex_free_vec_count  = 0;
+}
+void MVM_tc_clear_ex_free_vec_pieces(MVMThreadContext *tc) {
+    tc->ex_free_vec_pieces = NULL;
+    tc->ex_free_vec_count  = 0;
+}
@@ -277,6 +277,11 @@ struct MVMThreadContext {
      * like I/O, which grab a mutex but may throw an exception. */
     uv_mutex_t *ex_release_mutex;
 
+    /* The pieces of a vectored write that must be freed if we throw an
+     * exception while building or writing them. */
+    MVMIOVecPiece *ex_free_vec_pieces;
+    MVMuint32      ex_free_vec_count;
+
     /* Serialization context write barrier disabled depth (anything non-zero
      * means disabled). */
     MVMint32           sc_wb_disable_depth;
@@ -306,6 +311,7 @@ struct MVMThreadContext {
 
     /* NFA evaluator memory cache, to avoid many allocations; see NFA.c. */
     MVMuint32 *nfa_done;
+    MVMuint32  nfa_done_gen;
     MVMuint32 *nfa_curst;
     MVMuint32 *nfa_nextst;
     MVMint64   nfa_alloc_states;
@@ -314,6 +320,12 @@ struct MVMThreadContext {
     MVMint64 *nfa_longlit;
     MVMint64  nfa_longlit_len;
 
+    /* Cache of recently used NFG synthetics; see nfg.c. */
+    MVMNFGCacheEntry *nfg_cache;
+
+    /* If this is an event loop thread, the loop that it runs. */
+    MVMIOEventLoop *event_loop;
+
     /* Memory for doing multi-dim indexing with late-bound dimension counts. */
     MVMint64 *multi_dim_indices;
     MVMint64  num_multi_dim_indices;
@@ -340,3 +352,6 @@ void MVM_tc_set_ex_release_mutex(MVMThreadContext *tc, uv_mutex_t *mutex);
 void MVM_tc_set_ex_release_atomic(MVMThreadContext *tc, AO_t *flag);
 void MVM_tc_release_ex_release_mutex(MVMThreadContext *tc);
 void MVM_tc_clear_ex_release_mutex(MVMThreadContext *tc);
+void MVM_tc_set_ex_free_vec_pieces(MVMThreadContext *tc, MVMIOVecPiece *pieces, MVMuint32 count);
+void MVM_tc_free_ex_free_vec_pieces(MVMThreadContext *tc);
+void MVM_tc_clear_ex_free_vec_pieces(MVMThreadContext *tc);
@@ -2050,6 +2050,7 @@ static MVMint32 request_object_metadata(MVMThreadContext *dtc, cmp_ctx_t *ctx, r
             case MVM_STRING_GRAPHEME_ASCII: cmp_write_str(ctx, "graphemeASCII", 13); break;
             case MVM_STRING_GRAPHEME_8:     cmp_write_str(ctx, "grapheme8", 9); break;
             case MVM_STRING_STRAND:         cmp_write_str(ctx, "strands", 7); break;
+            case MVM_STRING_IN_SITU_8:      cmp_write_str(ctx, "inSitu8", 7); break;
             default: cmp_write_str(ctx, "???", 3);
         }
 
@@ -139,6 +139,8 @@ void MVM_cross_thread_write_instrument(MVMThreadContext *tc, MVMStaticFrame *sf)
 
 /* Filter out some special cases to reduce noise. */
 static MVMint64 filtered_out(MVMThreadContext *tc, MVMObject *written) {
+    MVMuint32 i;
+
     /* If we're holding locks, exclude by default (unless we were asked to
      * also include these). */
     if (tc->num_locks && !tc->instance->cross_thread_write_logging_include_locked)
@@ -149,8 +151,8 @@ static MVMint64 filtered_out(MVMThreadContext *tc, MVMObject *written) {
         return 1;
 
     /* Write on object from event loop thread is usually shift of invokable. */
-    if (tc->instance->event_loop_thread) {
-        MVMThread *thread = (MVMThread*)tc->instance->event_loop_thread;
+    for (i = 0; i < tc->instance->num_event_loops; i++) {
+        MVMThread *thread = (MVMThread*)tc->instance->event_loops[i].thread;
         if (thread != NULL && written->header.owner == thread->body.tc->thread_id)
             return 1;
     }
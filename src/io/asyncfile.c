@@ -0,0 +1,735 @@
+#include "moar.h"
+
+#ifndef _WIN32
+#define DEFAULT_MODE 0x01B6
+#else
+#include <fcntl.h>
+#define DEFAULT_MODE _S_IWRITE /* work around sucky libuv defaults */
+#endif
+
+/* Asynchronous file I/O. The file system calls run on libuv's thread pool,
+ * and complete on the event loop that the file handle belongs to, which
+ * pushes the results to the task's queue in the same way as for sockets.
+ * There is no io_uring backend; each call takes up a thread pool thread for
+ * as long as it blocks. */
+
+/* Number of bytes we read at a time. */
+#define CHUNK_SIZE 65536
+
+/* Kinds of operation that go through a file's queue of writes. */
+#define FILE_OP_WRITE 0
+#define FILE_OP_SYNC  1
+#define FILE_OP_CLOSE 2
+
+/* An operation waiting in or going through a file's queue of writes. */
+typedef struct FileOpInfo {
+    /* The kind of operation. */
+    int kind;
+
+    /* The handle and, for a write, the buffer. */
+    MVMOSHandle *handle;
+    MVMObject   *buf_data;
+
+    /* The request, and what is left to write. */
+    uv_fs_t      req;
+    uv_buf_t     buf;
+    MVMint64     written;
+
+    /* The next operation in the queue. */
+    struct FileOpInfo *next;
+
+    MVMThreadContext *tc;
+    int               work_idx;
+} FileOpInfo;
+
+/* Data that we keep for an asynchronous file handle. */
+typedef struct {
+    /* The file descriptor; -1 once closed. */
+    uv_file fd;
+
+    /* Can we read at a given offset (pread), rather than at the current
+     * position? */
+    int seekable;
+
+    /* Where the next read will be from, if seekable. Reads keep their own
+     * position, and writes go to the file's current position. */
+    MVMint64 read_pos;
+
+    /* Reads running on the thread pool; a close waits for them. */
+    MVMuint32 reads_in_flight;
+
+    /* Is a read task going? There may only be one at a time, since reads
+     * share the position. Set and cleared on the event loop, when the read
+     * is set up and when it ends; other threads only look at it. */
+    AO_t reading;
+
+    /* Has a close been asked for? No new reads start after that. Set by the
+     * thread closing the file, and read on the event loop. */
+    AO_t closing;
+
+    /* Writes, syncs and the close run one at a time, in the order they were
+     * asked for; this is the one in progress, and those waiting. */
+    FileOpInfo *op_in_flight;
+    FileOpInfo *op_queue_head;
+    FileOpInfo *op_queue_tail;
+
+    /* The event loop the file lives on; all work on it is done there. */
+    MVMIOEventLoop *event_loop;
+} MVMIOAsyncFileData;
+
+static void start_next_op(MVMThreadContext *tc, uv_loop_t *loop, MVMIOAsyncFileData *data);
+
+/* Pushes [schedulee, result, error] for a task to its queue, where the
+ * error is a type object if status is not negative. */
+static void push_result(MVMThreadContext *tc, MVMAsyncTask *t, MVMObject *result_type,
+                        MVMint64 result, int status) {
+    MVMObject *arr;
+    MVMROOT(tc, t, {
+        arr = MVM_repr_alloc_init(tc, tc->instance->boot_types.BOOTArray);
+        MVM_repr_push_o(tc, arr, t->body.schedulee);
+        MVMROOT(tc, arr, {
+            if (status >= 0) {
+                MVMObject *result_box = MVM_repr_box_int(tc,
+                    tc->instance->boot_types.BOOTInt, result);
+                MVM_repr_push_o(tc, arr, result_box);
+                MVM_repr_push_o(tc, arr, tc->instance->boot_types.BOOTStr);
+            }
+            else {
+                MVMString *msg_str = MVM_string_ascii_decode_nt(tc,
+                    tc->instance->VMString, uv_strerror(status));
+                MVMObject *msg_box;
+                MVM_repr_push_o(tc, arr, result_type);
+                msg_box = MVM_repr_box_str(tc,
+                    tc->instance->boot_types.BOOTStr, msg_str);
+                MVM_repr_push_o(tc, arr, msg_box);
+            }
+        });
+    });
+    MVM_repr_push_o(tc, t->body.queue, arr);
+}
+
+/* Info we convey about a read task. */
+typedef struct {
+    MVMOSHandle      *handle;
+    MVMObject        *buf_type;
+    int               seq_number;
+    uv_fs_t           req;
+    char             *buf;
+    int               in_flight;
+    int               cancelled;
+    MVMThreadContext *tc;
+    int               work_idx;
+} ReadInfo;
+
+static void issue_read(MVMThreadContext *tc, uv_loop_t *loop, ReadInfo *ri);
+
+/* Ends a read task, once nothing is running for it on the thread pool. */
+static void read_done(MVMThreadContext *tc, uv_loop_t *loop, ReadInfo *ri) {
+    MVMIOAsyncFileData *data = (MVMIOAsyncFileData *)ri->handle->body.data;
+    MVM_io_eventloop_remove_active_work(tc, &(ri->work_idx));
+    MVM_store(&data->reading, 0);
+
+    /* A close may have been waiting for the read. */
+    if (data->reads_in_flight == 0 && !data->op_in_flight && data->op_queue_head)
+        start_next_op(tc, loop, data);
+}
+
+/* Pushes the end of a read, [schedulee, final sequence number, Str, Str];
+ * sent at the end of the file, and when a close stops the read early. */
+static void push_read_end(MVMThreadContext *tc, MVMAsyncTask *t, ReadInfo *ri) {
+    MVMObject *arr;
+    MVMROOT(tc, t, {
+        arr = MVM_repr_alloc_init(tc, tc->instance->boot_types.BOOTArray);
+        MVM_repr_push_o(tc, arr, t->body.schedulee);
+        MVMROOT(tc, arr, {
+            MVMObject *final = MVM_repr_box_int(tc,
+                tc->instance->boot_types.BOOTInt, ri->seq_number);
+            MVM_repr_push_o(tc, arr, final);
+            MVM_repr_push_o(tc, arr, tc->instance->boot_types.BOOTStr);
+            MVM_repr_push_o(tc, arr, tc->instance->boot_types.BOOTStr);
+        });
+    });
+    MVM_repr_push_o(tc, t->body.queue, arr);
+}
+
+/* Pushes a read error, [schedulee, Int, Str, message]. */
+static void push_read_error(MVMThreadContext *tc, MVMAsyncTask *t, int status) {
+    MVMObject *arr;
+    MVMROOT(tc, t, {
+        arr = MVM_repr_alloc_init(tc, tc->instance->boot_types.BOOTArray);
+        MVM_repr_push_o(tc, arr, t->body.schedulee);
+        MVM_repr_push_o(tc, arr, tc->instance->boot_types.BOOTInt);
+        MVM_repr_push_o(tc, arr, tc->instance->boot_types.BOOTStr);
+        MVMROOT(tc, arr, {
+            MVMString *msg_str = MVM_string_ascii_decode_nt(tc,
+                tc->instance->VMString, uv_strerror(status));
+            MVMObject *msg_box = MVM_repr_box_str(tc,
+                tc->instance->boot_types.BOOTStr, msg_str);
+            MVM_repr_push_o(tc, arr, msg_box);
+        });
+    });
+    MVM_repr_push_o(tc, t->body.queue, arr);
+}
+
+/* Completion handler for a read of a chunk. */
+static void on_read(uv_fs_t *req) {
+    ReadInfo           *ri     = (ReadInfo *)req->data;
+    MVMThreadContext   *tc     = ri->tc;
+    MVMIOAsyncFileData *data   = (MVMIOAsyncFileData *)ri->handle->body.data;
+    uv_loop_t          *loop   = req->loop;
+    ssize_t             result = req->result;
+    MVMAsyncTask       *t      = MVM_io_eventloop_get_active_work(tc, ri->work_idx);
+    MVMObject          *arr;
+    uv_fs_req_cleanup(req);
+    ri->in_flight = 0;
+    data->reads_in_flight--;
+
+    if (ri->cancelled) {
+        MVM_free_null(ri->buf);
+        read_done(tc, loop, ri);
+        return;
+    }
+    if (result >= 0 && MVM_load(&data->closing)) {
+        /* What was read is of no use any more, but the reader still needs
+         * to know that there will be no more. */
+        push_read_end(tc, t, ri);
+        MVM_free_null(ri->buf);
+        read_done(tc, loop, ri);
+        return;
+    }
+
+    arr = MVM_repr_alloc_init(tc, tc->instance->boot_types.BOOTArray);
+    MVM_repr_push_o(tc, arr, t->body.schedulee);
+    if (result > 0) {
+        MVMROOT2(tc, t, arr, {
+            MVMArray *res_buf;
+
+            /* Push the sequence number. */
+            MVMObject *seq_boxed = MVM_repr_box_int(tc,
+                tc->instance->boot_types.BOOTInt, ri->seq_number++);
+            MVM_repr_push_o(tc, arr, seq_boxed);
+
+            /* Produce a buffer and push it. */
+            res_buf      = (MVMArray *)MVM_repr_alloc_init(tc, ri->buf_type);
+            res_buf->body.slots.i8 = (MVMint8 *)ri->buf;
+            res_buf->body.start    = 0;
+            res_buf->body.ssize    = CHUNK_SIZE;
+            res_buf->body.elems    = result;
+            MVM_repr_push_o(tc, arr, (MVMObject *)res_buf);
+            ri->buf = NULL;
+
+            /* Finally, no error. */
+            MVM_repr_push_o(tc, arr, tc->instance->boot_types.BOOTStr);
+        });
+        MVM_repr_push_o(tc, t->body.queue, arr);
+        if (data->seekable)
+            data->read_pos += result;
+        issue_read(tc, loop, ri);
+    }
+    else if (result == 0) {
+        push_read_end(tc, t, ri);
+        MVM_free_null(ri->buf);
+        read_done(tc, loop, ri);
+    }
+    else {
+        MVM_repr_push_o(tc, arr, tc->instance->boot_types.BOOTInt);
+        MVM_repr_push_o(tc, arr, tc->instance->boot_types.BOOTStr);
+        MVMROOT2(tc, t, arr, {
+            MVMString *msg_str = MVM_string_ascii_decode_nt(tc,
+                tc->instance->VMString, uv_strerror(result));
+            MVMObject *msg_box = MVM_repr_box_str(tc,
+                tc->instance->boot_types.BOOTStr, msg_str);
+            MVM_repr_push_o(tc, arr, msg_box);
+        });
+        MVM_repr_push_o(tc, t->body.queue, arr);
+        MVM_free_null(ri->buf);
+        read_done(tc, loop, ri);
+    }
+}
+
+/* Starts reading the next chunk on the thread pool. */
+static void issue_read(MVMThreadContext *tc, uv_loop_t *loop, ReadInfo *ri) {
+    MVMIOAsyncFileData *data = (MVMIOAsyncFileData *)ri->handle->body.data;
+    uv_buf_t            buf;
+    int                 r;
+    if (MVM_load(&data->closing)) {
+        push_read_end(tc, MVM_io_eventloop_get_active_work(tc, ri->work_idx), ri);
+        read_done(tc, loop, ri);
+        return;
+    }
+    if (!ri->buf)
+        ri->buf = MVM_malloc(CHUNK_SIZE);
+    buf = uv_buf_init(ri->buf, CHUNK_SIZE);
+    ri->req.data = ri;
+    if ((r = uv_fs_read(loop, &ri->req, data->fd, &buf, 1,
+            data->seekable ? data->read_pos : -1, on_read)) < 0) {
+        /* Report it as though the read had completed with the error. */
+        ri->req.result = r;
+        ri->req.loop   = loop;
+        data->reads_in_flight++;
+        on_read(&ri->req);
+        return;
+    }
+    ri->in_flight = 1;
+    data->reads_in_flight++;
+}
+
+/* Does setup work for reading a file. */
+static void read_setup(MVMThreadContext *tc, uv_loop_t *loop, MVMObject *async_task, void *data) {
+    ReadInfo           *ri          = (ReadInfo *)data;
+    MVMIOAsyncFileData *handle_data = (MVMIOAsyncFileData *)ri->handle->body.data;
+    ri->tc       = tc;
+    ri->work_idx = MVM_io_eventloop_add_active_work(tc, async_task);
+
+    /* Only one read at a time; a second one that got past the check made
+     * when it was started fails here. */
+    if (!MVM_trycas(&handle_data->reading, 0, 1)) {
+        push_read_error(tc, (MVMAsyncTask *)async_task, UV_EBUSY);
+        MVM_io_eventloop_remove_active_work(tc, &(ri->work_idx));
+        return;
+    }
+    issue_read(tc, loop, ri);
+}
+
+/* Stops reading; a read already running on the thread pool can't be
+ * stopped, so we just don't deliver what it reads. */
+static void read_cancel(MVMThreadContext *tc, uv_loop_t *loop, MVMObject *async_task, void *data) {
+    ReadInfo *ri = (ReadInfo *)data;
+    if (ri->work_idx >= 0) {
+        if (ri->in_flight)
+            ri->cancelled = 1;
+        else
+            read_done(tc, loop, ri);
+    }
+}
+
+/* Marks objects for a read task. */
+static void read_gc_mark(MVMThreadContext *tc, void *data, MVMGCWorklist *worklist) {
+    ReadInfo *ri = (ReadInfo *)data;
+    MVM_gc_worklist_add(tc, worklist, &ri->buf_type);
+    MVM_gc_worklist_add(tc, worklist, &ri->handle);
+}
+
+/* Frees info for a read task. */
+static void read_gc_free(MVMThreadContext *tc, MVMObject *t, void *data) {
+    if (data) {
+        MVM_free(((ReadInfo *)data)->buf);
+        MVM_free(data);
+    }
+}
+
+/* Operations table for async read task. */
+static const MVMAsyncTaskOps read_op_table = {
+    read_setup,
+    NULL,
+    read_cancel,
+    read_gc_mark,
+    read_gc_free
+};
+
+static MVMAsyncTask * read_bytes(MVMThreadContext *tc, MVMOSHandle *h, MVMObject *queue,
+                                 MVMObject *schedulee, MVMObject *buf_type, MVMObject *async_type) {
+    MVMAsyncTask *task;
+    ReadInfo     *ri;
+
+    /* Validate REPRs. */
+    if (REPR(queue)->ID != MVM_REPR_ID_ConcBlockingQueue)
+        MVM_exception_throw_adhoc(tc,
+            "asyncreadbytes target queue must have ConcBlockingQueue REPR");
+    if (REPR(async_type)->ID != MVM_REPR_ID_MVMAsyncTask)
+        MVM_exception_throw_adhoc(tc,
+            "asyncreadbytes result type must have REPR AsyncTask");
+    if (REPR(buf_type)->ID == MVM_REPR_ID_VMArray) {
+        MVMint32 slot_type = ((MVMArrayREPRData *)STABLE(buf_type)->REPR_data)->slot_type;
+        if (slot_type != MVM_ARRAY_U8 && slot_type != MVM_ARRAY_I8)
+            MVM_exception_throw_adhoc(tc, "asyncreadbytes buffer type must be an array of uint8 or int8");
+    }
+    else {
+        MVM_exception_throw_adhoc(tc, "asyncreadbytes buffer type must be an array");
+    }
+    if (MVM_load(&((MVMIOAsyncFileData *)h->body.data)->closing))
+        MVM_exception_throw_adhoc(tc, "Cannot read from a closed file");
+    if (MVM_load(&((MVMIOAsyncFileData *)h->body.data)->reading))
+        MVM_exception_throw_adhoc(tc, "Cannot read from a file that is already being read from");
+
+    /* Create async task handle. */
+    MVMROOT4(tc, queue, schedulee, h, buf_type, {
+        task = (MVMAsyncTask *)MVM_repr_alloc_init(tc, async_type);
+    });
+    MVM_ASSIGN_REF(tc, &(task->common.header), task->body.queue, queue);
+    MVM_ASSIGN_REF(tc, &(task->common.header), task->body.schedulee, schedulee);
+    task->body.ops  = &read_op_table;
+    ri              = MVM_calloc(1, sizeof(ReadInfo));
+    MVM_ASSIGN_REF(tc, &(task->common.header), ri->buf_type, buf_type);
+    MVM_ASSIGN_REF(tc, &(task->common.header), ri->handle, h);
+    task->body.data = ri;
+    task->body.event_loop = ((MVMIOAsyncFileData *)h->body.data)->event_loop;
+
+    /* Hand the task off to the event loop. */
+    MVMROOT(tc, task, {
+        MVM_io_eventloop_queue_work(tc, (MVMObject *)task);
+    });
+
+    return task;
+}
+
+/* Completes the operation in progress on a file: pushes
+ * [schedulee, bytes written (or 0), error], unless nobody asked to be told
+ * (as for a close), and starts the next one. */
+static void op_done(MVMThreadContext *tc, uv_loop_t *loop, FileOpInfo *oi, int status) {
+    MVMIOAsyncFileData *data = (MVMIOAsyncFileData *)oi->handle->body.data;
+    MVMAsyncTask       *t    = MVM_io_eventloop_get_active_work(tc, oi->work_idx);
+    data->op_in_flight = NULL;
+    if (t->body.queue)
+        push_result(tc, t, tc->instance->boot_types.BOOTInt, oi->written, status);
+    MVM_io_eventloop_remove_active_work(tc, &(oi->work_idx));
+    if (data->op_queue_head)
+        start_next_op(tc, loop, data);
+}
+
+/* Completion handler for a write, sync or close. */
+static void on_op(uv_fs_t *req) {
+    FileOpInfo         *oi     = (FileOpInfo *)req->data;
+    MVMThreadContext   *tc     = oi->tc;
+    MVMIOAsyncFileData *data   = (MVMIOAsyncFileData *)oi->handle->body.data;
+    uv_loop_t          *loop   = req->loop;
+    ssize_t             result = req->result;
+    int                 r;
+    uv_fs_req_cleanup(req);
+
+    if (result >= 0 && oi->kind == FILE_OP_WRITE) {
+        /* Carry on with the rest after a partial write. */
+        oi->written  += result;
+        oi->buf.base += result;
+        oi->buf.len  -= result;
+        if (oi->buf.len > 0) {
+            req->data = oi;
+            if ((r = uv_fs_write(loop, req, data->fd, &oi->buf, 1, -1, on_op)) < 0)
+                op_done(tc, loop, oi, r);
+            return;
+        }
+    }
+    op_done(tc, loop, oi, result < 0 ? (int)result : 0);
+}
+
+/* Starts the next operation in a file's queue, unless one is in progress;
+ * a close also waits for any reads to finish. */
+static void start_next_op(MVMThreadContext *tc, uv_loop_t *loop, MVMIOAsyncFileData *data) {
+    FileOpInfo *oi = data->op_queue_head;
+    int         r  = 0;
+    if (!oi || data->op_in_flight)
+        return;
+    if (oi->kind == FILE_OP_CLOSE && data->reads_in_flight > 0)
+        return;
+    data->op_queue_head = oi->next;
+    if (!data->op_queue_head)
+        data->op_queue_tail = NULL;
+    data->op_in_flight = oi;
+    oi->req.data = oi;
+
+    if (data->fd < 0) {
+        op_done(tc, loop, oi, UV_EBADF);
+        return;
+    }
+    switch (oi->kind) {
+        case FILE_OP_WRITE: {
+            MVMArray *buffer = (MVMArray *)oi->buf_data;
+            oi->buf = uv_buf_init((char *)(buffer->body.slots.i8 + buffer->body.start),
+                (unsigned int)buffer->body.elems);
+            r = uv_fs_write(loop, &oi->req, data->fd, &oi->buf, 1, -1, on_op);
+            break;
+        }
+        case FILE_OP_SYNC:
+            r = uv_fs_fsync(loop, &oi->req, data->fd, on_op);
+            break;
+        case FILE_OP_CLOSE:
+            r = uv_fs_close(loop, &oi->req, data->fd, on_op);
+            data->fd = -1;
+            break;
+    }
+    if (r < 0)
+        op_done(tc, loop, oi, r);
+}
+
+/* Does setup work for a write, sync or close: queues it up behind any
+ * others on the file. */
+static void op_setup(MVMThreadContext *tc, uv_loop_t *loop, MVMObject *async_task, void *info) {
+    FileOpInfo         *oi   = (FileOpInfo *)info;
+    MVMIOAsyncFileData *data = (MVMIOAsyncFileData *)oi->handle->body.data;
+    oi->tc       = tc;
+    oi->work_idx = MVM_io_eventloop_add_active_work(tc, async_task);
+    if (data->op_queue_tail)
+        data->op_queue_tail->next = oi;
+    else
+        data->op_queue_head = oi;
+    data->op_queue_tail = oi;
+    start_next_op(tc, loop, data);
+}
+
+/* Marks objects for a write, sync or close task. */
+static void op_gc_mark(MVMThreadContext *tc, void *data, MVMGCWorklist *worklist) {
+    FileOpInfo *oi = (FileOpInfo *)data;
+    MVM_gc_worklist_add(tc, worklist, &oi->handle);
+    MVM_gc_worklist_add(tc, worklist, &oi->buf_data);
+}
+
+/* Frees info for a write, sync or close task. */
+static void op_gc_free(MVMThreadContext *tc, MVMObject *t, void *data) {
+    if (data)
+        MVM_free(data);
+}
+
+/* Operations table for async write, sync and close tasks. */
+static const MVMAsyncTaskOps op_op_table = {
+    op_setup,
+    NULL,
+    NULL,
+    op_gc_mark,
+    op_gc_free
+};
+
+/* Creates a task for an operation that goes through a file's queue. */
+static MVMAsyncTask * queue_op(MVMThreadContext *tc, MVMOSHandle *h, int kind, MVMObject *queue,
+                               MVMObject *schedulee, MVMObject *buffer, MVMObject *async_type) {
+    MVMAsyncTask *task;
+    FileOpInfo   *oi;
+
+    MVMROOT4(tc, queue, schedulee, h, buffer, {
+        task = (MVMAsyncTask *)MVM_repr_alloc_init(tc, async_type);
+    });
+    if (queue)
+        MVM_ASSIGN_REF(tc, &(task->common.header), task->body.queue, queue);
+    if (schedulee)
+        MVM_ASSIGN_REF(tc, &(task->common.header), task->body.schedulee, schedulee);
+    task->body.ops  = &op_op_table;
+    oi              = MVM_calloc(1, sizeof(FileOpInfo));
+    oi->kind        = kind;
+    MVM_ASSIGN_REF(tc, &(task->common.header), oi->handle, h);
+    if (buffer)
+        MVM_ASSIGN_REF(tc, &(task->common.header), oi->buf_data, buffer);
+    task->body.data = oi;
+    task->body.event_loop = ((MVMIOAsyncFileData *)h->body.data)->event_loop;
+
+    /* Hand the task off to the event loop. */
+    MVMROOT(tc, task, {
+        MVM_io_eventloop_queue_work(tc, (MVMObject *)task);
+    });
+
+    return task;
+}
+
+static MVMAsyncTask * write_bytes(MVMThreadContext *tc, MVMOSHandle *h, MVMObject *queue,
+                                  MVMObject *schedulee, MVMObject *buffer, MVMObject *async_type) {
+    /* Validate REPRs. */
+    if (REPR(queue)->ID != MVM_REPR_ID_ConcBlockingQueue)
+        MVM_exception_throw_adhoc(tc,
+            "asyncwritebytes target queue must have ConcBlockingQueue REPR");
+    if (REPR(async_type)->ID != MVM_REPR_ID_MVMAsyncTask)
+        MVM_exception_throw_adhoc(tc,
+            "asyncwritebytes result type must have REPR AsyncTask");
+    if (!IS_CONCRETE(buffer) || REPR(buffer)->ID != MVM_REPR_ID_VMArray)
+        MVM_exception_throw_adhoc(tc, "asyncwritebytes requires a native array to read from");
+    if (((MVMArrayREPRData *)STABLE(buffer)->REPR_data)->slot_type != MVM_ARRAY_U8
+        && ((MVMArrayREPRData *)STABLE(buffer)->REPR_data)->slot_type != MVM_ARRAY_I8)
+        MVM_exception_throw_adhoc(tc, "asyncwritebytes requires a native array of uint8 or int8");
+    if (MVM_load(&((MVMIOAsyncFileData *)h->body.data)->closing))
+        MVM_exception_throw_adhoc(tc, "Cannot write to a closed file");
+
+    return queue_op(tc, h, FILE_OP_WRITE, queue, schedulee, buffer, async_type);
+}
+
+/* Closes the file, once any writes asked for before are done. There is
+ * nobody to tell about how that went. */
+static MVMint64 closefh(MVMThreadContext *tc, MVMOSHandle *h) {
+    MVMIOAsyncFileData *data = (MVMIOAsyncFileData *)h->body.data;
+    if (MVM_trycas(&data->closing, 0, 1))
+        queue_op(tc, h, FILE_OP_CLOSE, NULL, NULL, NULL, tc->instance->boot_types.BOOTAsync);
+    return 0;
+}
+
+/* Frees data associated with the handle, closing the file if that never
+ * happened; no task refers to the handle any more, so nothing can be using
+ * it. */
+static void gc_free(MVMThreadContext *tc, MVMObject *h, void *d) {
+    MVMIOAsyncFileData *data = (MVMIOAsyncFileData *)d;
+    if (data) {
+        if (data->fd >= 0) {
+            uv_fs_t req;
+            uv_fs_close(NULL, &req, data->fd, NULL);
+            uv_fs_req_cleanup(&req);
+        }
+        MVM_free(data);
+    }
+}
+
+/* IO ops table, populated with functions. */
+static const MVMIOClosable      closable       = { closefh };
+static const MVMIOAsyncReadable async_readable = { read_bytes };
+static const MVMIOAsyncWritable async_writable = { write_bytes };
+static const MVMIOOps op_table = {
+    &closable,
+    NULL,
+    NULL,
+    &async_readable,
+    &async_writable,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    gc_free
+};
+
+/* Info we convey about a file open task. */
+typedef struct {
+    char             *path;
+    int               flags;
+    uv_fs_t           req;
+    MVMThreadContext *tc;
+    int               work_idx;
+} OpenInfo;
+
+/* Completion handler for opening a file; pushes [schedulee, handle, error]. */
+static void on_open(uv_fs_t *req) {
+    OpenInfo         *oi     = (OpenInfo *)req->data;
+    MVMThreadContext *tc     = oi->tc;
+    ssize_t           result = req->result;
+    MVMAsyncTask     *t      = MVM_io_eventloop_get_active_work(tc, oi->work_idx);
+    MVMObject        *arr;
+    uv_fs_req_cleanup(req);
+
+    MVMROOT(tc, t, {
+        arr = MVM_repr_alloc_init(tc, tc->instance->boot_types.BOOTArray);
+        MVM_repr_push_o(tc, arr, t->body.schedulee);
+        MVMROOT(tc, arr, {
+            if (result >= 0) {
+                MVMOSHandle        *handle = (MVMOSHandle *)MVM_repr_alloc_init(tc,
+                    tc->instance->boot_types.BOOTIO);
+                MVMIOAsyncFileData *data   = MVM_calloc(1, sizeof(MVMIOAsyncFileData));
+                data->fd           = (uv_file)result;
+                data->seekable     = MVM_platform_is_fd_seekable(data->fd);
+                data->event_loop   = tc->event_loop;
+                handle->body.ops   = &op_table;
+                handle->body.data  = data;
+                MVM_repr_push_o(tc, arr, (MVMObject *)handle);
+                MVM_repr_push_o(tc, arr, tc->instance->boot_types.BOOTStr);
+            }
+            else {
+                MVMString *msg_str = MVM_string_ascii_decode_nt(tc,
+                    tc->instance->VMString, uv_strerror(result));
+                MVMObject *msg_box;
+                MVM_repr_push_o(tc, arr, tc->instance->boot_types.BOOTIO);
+                msg_box = MVM_repr_box_str(tc,
+                    tc->instance->boot_types.BOOTStr, msg_str);
+                MVM_repr_push_o(tc, arr, msg_box);
+            }
+        });
+    });
+    MVM_repr_push_o(tc, t->body.queue, arr);
+    MVM_io_eventloop_remove_active_work(tc, &(oi->work_idx));
+}
+
+/* Does setup work for opening a file. */
+static void open_setup(MVMThreadContext *tc, uv_loop_t *loop, MVMObject *async_task, void *data) {
+    OpenInfo *oi = (OpenInfo *)data;
+    int       r;
+    oi->tc       = tc;
+    oi->work_idx = MVM_io_eventloop_add_active_work(tc, async_task);
+    oi->req.data = oi;
+    if ((r = uv_fs_open(loop, &oi->req, oi->path, oi->flags, DEFAULT_MODE, on_open)) < 0) {
+        oi->req.result = r;
+        on_open(&oi->req);
+    }
+}
+
+/* Frees info for a file open task. */
+static void open_gc_free(MVMThreadContext *tc, MVMObject *t, void *data) {
+    if (data) {
+        MVM_free(((OpenInfo *)data)->path);
+        MVM_free(data);
+    }
+}
+
+/* Operations table for async file open task. */
+static const MVMAsyncTaskOps open_op_table = {
+    open_setup,
+    NULL,
+    NULL,
+    NULL,
+    open_gc_free
+};
+
+/* Opens a file asynchronously, taking the same modes as MVM_file_open_fh.
+ * The handle it produces does reads with asyncreadbytes and writes with
+ * asyncwritebytes. */
+MVMObject * MVM_io_file_open_async(MVMThreadContext *tc, MVMObject *queue,
+                                   MVMObject *schedulee, MVMString *filename,
+                                   MVMString *mode, MVMObject *async_type) {
+    MVMAsyncTask *task;
+    OpenInfo     *oi;
+    char         *fname, *fmode;
+    int           flags;
+
+    /* Validate REPRs. */
+    if (REPR(queue)->ID != MVM_REPR_ID_ConcBlockingQueue)
+        MVM_exception_throw_adhoc(tc,
+            "asyncopenfile target queue must have ConcBlockingQueue REPR");
+    if (REPR(async_type)->ID != MVM_REPR_ID_MVMAsyncTask)
+        MVM_exception_throw_adhoc(tc,
+            "asyncopenfile result type must have REPR AsyncTask");
+
+    /* Resolve mode description to flags. */
+    fmode = MVM_string_utf8_encode_C_string(tc, mode);
+    if (!MVM_file_resolve_open_mode(&flags, fmode)) {
+        char *waste[] = { fmode, NULL };
+        MVM_exception_throw_adhoc_free(tc, waste, "Invalid open mode for file: %s", fmode);
+    }
+    MVM_free(fmode);
+#ifdef _WIN32
+    flags |= _O_BINARY;
+#endif
+    fname = MVM_string_utf8_c8_encode_C_string(tc, filename);
+
+    /* Create async task handle. */
+    MVMROOT2(tc, queue, schedulee, {
+        task = (MVMAsyncTask *)MVM_repr_alloc_init(tc, async_type);
+    });
+    MVM_ASSIGN_REF(tc, &(task->common.header), task->body.queue, queue);
+    MVM_ASSIGN_REF(tc, &(task->common.header), task->body.schedulee, schedulee);
+    task->body.ops  = &open_op_table;
+    oi              = MVM_calloc(1, sizeof(OpenInfo));
+    oi->path        = fname;
+    oi->flags       = flags;
+    task->body.data = oi;
+
+    /* Hand the task off to the event loop. */
+    MVMROOT(tc, task, {
+        MVM_io_eventloop_queue_work(tc, (MVMObject *)task);
+    });
+
+    return (MVMObject *)task;
+}
+
+/* Flushes a file to storage asynchronously, once any writes asked for
+ * before are done; pushes [schedulee, 0, error]. */
+MVMObject * MVM_io_file_fsync_async(MVMThreadContext *tc, MVMObject *handle, MVMObject *queue,
+                                    MVMObject *schedulee, MVMObject *async_type) {
+    /* Validate REPRs. */
+    if (REPR(queue)->ID != MVM_REPR_ID_ConcBlockingQueue)
+        MVM_exception_throw_adhoc(tc,
+            "asyncfsync target queue must have ConcBlockingQueue REPR");
+    if (REPR(async_type)->ID != MVM_REPR_ID_MVMAsyncTask)
+        MVM_exception_throw_adhoc(tc,
+            "asyncfsync result type must have REPR AsyncTask");
+    if (REPR(handle)->ID != MVM_REPR_ID_MVMOSHandle || !IS_CONCRETE(handle)
+            || ((MVMOSHandle *)handle)->body.ops != &op_table)
+        MVM_exception_throw_adhoc(tc, "asyncfsync requires an asynchronous file handle");
+    if (MVM_load(&((MVMIOAsyncFileData *)((MVMOSHandle *)handle)->body.data)->closing))
+        MVM_exception_throw_adhoc(tc, "Cannot sync a closed file");
+
+    return (MVMObject *)queue_op(tc, (MVMOSHandle *)handle, FILE_OP_SYNC, queue,
+        schedulee, NULL, async_type);
+}
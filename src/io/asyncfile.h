@@ -0,0 +1,5 @@
+MVMObject * MVM_io_file_open_async(MVMThreadContext *tc, MVMObject *queue,
+                                   MVMObject *schedulee, MVMString *filename,
+                                   MVMString *mode, MVMObject *async_type);
+MVMObject * MVM_io_file_fsync_async(MVMThreadContext *tc, MVMObject *handle, MVMObject *queue,
+                                    MVMObject *schedulee, MVMObject *async_type);
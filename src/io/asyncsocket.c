@@ -1,9 +1,31 @@
 #include "moar.h"
 
+#ifndef _WIN32
+#include <unistd.h>
+#if defined(__linux__)
+#include <sys/sendfile.h>
+#elif defined(__FreeBSD__) || defined(__APPLE__)
+#include <sys/types.h>
+#include <sys/uio.h>
+#endif
+#endif
+
 /* Data that we keep for an asynchronous socket handle. */
 typedef struct {
     /* The libuv handle to the socket. */
     uv_stream_t *handle;
+
+    /* The event loop the socket lives on; all work on it is done there. */
+    MVMIOEventLoop *event_loop;
+
+    /* An accepted connection that was handed to another event loop than the
+     * one that accepted it is kept as a bare descriptor until it is first
+     * used on that loop. */
+    MVMuint8 pending;
+    int      pending_fd;
+
+    /* The sendfile in progress on the socket, if any. */
+    struct SendfileInfo *sendfile;
 } MVMIOAsyncSocketData;
 
 /* Info we convey about a read task. */
@@ -13,13 +35,27 @@ typedef struct {
     int               seq_number;
     MVMThreadContext *tc;
     int               work_idx;
+
+    /* The size of receive buffer to ask for next. */
+    size_t            recv_size;
 } ReadInfo;
 
-/* Allocates a buffer of the suggested size. */
+/* Gets a receive buffer from the event loop's pool. */
 static void on_alloc(uv_handle_t *handle, size_t suggested_size, uv_buf_t *buf) {
-    size_t size = suggested_size > 0 ? suggested_size : 4;
-    buf->base   = MVM_malloc(size);
-    buf->len    = size;
+    ReadInfo *ri = (ReadInfo *)handle->data;
+    size_t    size;
+    buf->base = MVM_io_eventloop_alloc_recv_buffer(MVM_io_eventloop_of(handle->loop),
+        ri->recv_size, &size);
+    buf->len  = size;
+}
+
+/* Picks the receive buffer size for the next read: a bigger one if this read
+ * filled its buffer, a smaller one if it used little of it. */
+static void adapt_recv_size(ReadInfo *ri, ssize_t nread, size_t size) {
+    if ((size_t)nread == size)
+        ri->recv_size = size * 4;
+    else if ((size_t)nread < size / 4)
+        ri->recv_size = (size_t)nread;
 }
 
 /* Callback used to simply free memory on close. */
@@ -27,14 +63,62 @@ static void free_on_close_cb(uv_handle_t *handle) {
     MVM_free(handle);
 }
 
+/* Gets the libuv stream for a socket, opening it on the event loop if it was
+ * handed over to that loop as a bare descriptor. Must be called on the
+ * socket's event loop. */
+static uv_stream_t * socket_stream(uv_loop_t *loop, MVMIOAsyncSocketData *handle_data) {
+#ifndef _WIN32
+    if (handle_data->pending) {
+        uv_tcp_t *socket = MVM_malloc(sizeof(uv_tcp_t));
+        handle_data->pending = 0;
+        uv_tcp_init(loop, socket);
+        if (uv_tcp_open(socket, handle_data->pending_fd) == 0) {
+            handle_data->handle = (uv_stream_t *)socket;
+        }
+        else {
+            close(handle_data->pending_fd);
+            uv_close((uv_handle_t *)socket, free_on_close_cb);
+        }
+    }
+#endif
+    return handle_data->handle;
+}
+
+/* Hands an accepted connection over to another event loop, so that the
+ * connections accepted by a listener get spread over all of the loops. The
+ * client handle is closed on this loop, keeping a duplicate of its
+ * descriptor to open on the other one. Not done on Windows, where the socket
+ * handle cannot be moved between loops this way. */
+static void hand_off_connection(MVMThreadContext *tc, MVMIOAsyncSocketData *data) {
+#ifndef _WIN32
+    MVMIOEventLoop *target;
+    uv_os_fd_t      fd;
+    int             dup_fd;
+    if (tc->instance->num_event_loops == 1)
+        return;
+    target = MVM_io_eventloop_next(tc);
+    if (target == data->event_loop)
+        return;
+    if (uv_fileno((uv_handle_t *)data->handle, &fd) != 0 || (dup_fd = dup(fd)) < 0)
+        return;
+    uv_close((uv_handle_t *)data->handle, free_on_close_cb);
+    data->handle     = NULL;
+    data->event_loop = target;
+    data->pending    = 1;
+    data->pending_fd = dup_fd;
+#endif
+}
+
 /* Read handler. */
 static void on_read(uv_stream_t *handle, ssize_t nread, const uv_buf_t *buf) {
     ReadInfo         *ri  = (ReadInfo *)handle->data;
     MVMThreadContext *tc  = ri->tc;
+    MVMIOEventLoop   *el  = MVM_io_eventloop_of(handle->loop);
     MVMObject        *arr = MVM_repr_alloc_init(tc, tc->instance->boot_types.BOOTArray);
     MVMAsyncTask     *t   = MVM_io_eventloop_get_active_work(tc, ri->work_idx);
     MVM_repr_push_o(tc, arr, t->body.schedulee);
     if (nread >= 0) {
+        adapt_recv_size(ri, nread, buf->len);
         MVMROOT2(tc, t, arr, {
             MVMArray *res_buf;
 
@@ -43,11 +127,22 @@ static void on_read(uv_stream_t *handle, ssize_t nread, const uv_buf_t *buf) {
                 tc->instance->boot_types.BOOTInt, ri->seq_number++);
             MVM_repr_push_o(tc, arr, seq_boxed);
 
-            /* Produce a buffer and push it. */
+            /* Produce a buffer and push it. A read that fills most of the
+             * receive buffer takes it over; a smaller one is copied out so
+             * the receive buffer can go back to the pool. */
             res_buf      = (MVMArray *)MVM_repr_alloc_init(tc, ri->buf_type);
-            res_buf->body.slots.i8 = (MVMint8 *)buf->base;
+            if ((size_t)nread > buf->len / 2) {
+                res_buf->body.slots.i8 = (MVMint8 *)buf->base;
+                res_buf->body.ssize    = buf->len;
+            }
+            else {
+                res_buf->body.slots.i8 = nread ? MVM_malloc(nread) : NULL;
+                res_buf->body.ssize    = nread;
+                if (nread)
+                    memcpy(res_buf->body.slots.i8, buf->base, nread);
+                MVM_io_eventloop_free_recv_buffer(el, buf->base, buf->len);
+            }
             res_buf->body.start    = 0;
-            res_buf->body.ssize    = buf->len;
             res_buf->body.elems    = nread;
             MVM_repr_push_o(tc, arr, (MVMObject *)res_buf);
 
@@ -79,7 +174,7 @@ static void on_read(uv_stream_t *handle, ssize_t nread, const uv_buf_t *buf) {
             });
         }
         if (buf->base)
-            MVM_free(buf->base);
+            MVM_io_eventloop_free_recv_buffer(el, buf->base, buf->len);
         MVM_io_eventloop_remove_active_work(tc, &(ri->work_idx));
         if (conn_handle && !uv_is_closing(conn_handle)) {
             handle_data->handle = NULL;
@@ -98,7 +193,7 @@ static void read_setup(MVMThreadContext *tc, uv_loop_t *loop, MVMObject *async_t
     /* Ensure not closed. */
     ri = (ReadInfo *)data;
     handle_data = (MVMIOAsyncSocketData *)ri->handle->body.data;
-    if (!handle_data->handle || uv_is_closing((uv_handle_t *)handle_data->handle)) {
+    if (!socket_stream(loop, handle_data) || uv_is_closing((uv_handle_t *)handle_data->handle)) {
         /* Closed, so immediately send done. */
         MVMAsyncTask *t = (MVMAsyncTask *)async_task;
         MVMROOT(tc, t, {
@@ -208,6 +303,7 @@ static MVMAsyncTask * read_bytes(MVMThreadContext *tc, MVMOSHandle *h, MVMObject
     MVM_ASSIGN_REF(tc, &(task->common.header), ri->buf_type, buf_type);
     MVM_ASSIGN_REF(tc, &(task->common.header), ri->handle, h);
     task->body.data = ri;
+    task->body.event_loop = ((MVMIOAsyncSocketData *)h->body.data)->event_loop;
 
     /* Hand the task off to the event loop. */
     MVMROOT(tc, task, {
@@ -217,12 +313,16 @@ static MVMAsyncTask * read_bytes(MVMThreadContext *tc, MVMOSHandle *h, MVMObject
     return task;
 }
 
-/* Info we convey about a write task. */
+/* Info we convey about a write task. For a vectored write, buf_data is the
+ * array of pieces, and pieces holds what they were turned into. */
 typedef struct {
     MVMOSHandle      *handle;
     MVMObject        *buf_data;
     uv_write_t       *req;
     uv_buf_t          buf;
+    MVMIOVecPiece    *pieces;
+    MVMuint32         num_pieces;
+    MVMuint64         pieces_total;
     MVMThreadContext *tc;
     int               work_idx;
 } WriteInfo;
@@ -238,7 +338,7 @@ static void on_write(uv_write_t *req, int status) {
         MVMROOT2(tc, arr, t, {
             MVMObject *bytes_box = MVM_repr_box_int(tc,
                 tc->instance->boot_types.BOOTInt,
-                wi->buf.len);
+                wi->pieces ? wi->pieces_total : wi->buf.len);
             MVM_repr_push_o(tc, arr, bytes_box);
         });
         MVM_repr_push_o(tc, arr, tc->instance->boot_types.BOOTStr);
@@ -255,6 +355,10 @@ static void on_write(uv_write_t *req, int status) {
     }
     MVM_repr_push_o(tc, t->body.queue, arr);
     MVM_free(wi->req);
+    if (wi->pieces) {
+        MVM_io_vec_pieces_free(tc, wi->pieces, wi->num_pieces);
+        wi->pieces = NULL;
+    }
     MVM_io_eventloop_remove_active_work(tc, &(wi->work_idx));
 }
 
@@ -269,7 +373,7 @@ static void write_setup(MVMThreadContext *tc, uv_loop_t *loop, MVMObject *async_
     /* Ensure not closed. */
     wi = (WriteInfo *)data;
     handle_data = (MVMIOAsyncSocketData *)wi->handle->body.data;
-    if (!handle_data->handle || uv_is_closing((uv_handle_t *)handle_data->handle)) {
+    if (!socket_stream(loop, handle_data) || uv_is_closing((uv_handle_t *)handle_data->handle)) {
         MVMROOT(tc, async_task, {
             MVMObject    *arr = MVM_repr_alloc_init(tc, tc->instance->boot_types.BOOTArray);
             MVM_repr_push_o(tc, arr, ((MVMAsyncTask *)async_task)->body.schedulee);
@@ -290,17 +394,35 @@ static void write_setup(MVMThreadContext *tc, uv_loop_t *loop, MVMObject *async_
     wi->tc = tc;
     wi->work_idx = MVM_io_eventloop_add_active_work(tc, async_task);
 
-    /* Extract buf data. */
-    buffer = (MVMArray *)wi->buf_data;
-    output = (char *)(buffer->body.slots.i8 + buffer->body.start);
-    output_size = (int)buffer->body.elems;
-
     /* Create and initialize write request. */
     wi->req           = MVM_malloc(sizeof(uv_write_t));
-    wi->buf           = uv_buf_init(output, output_size);
     wi->req->data     = data;
 
-    if ((r = uv_write(wi->req, handle_data->handle, &(wi->buf), 1, on_write)) < 0) {
+    if (wi->pieces && wi->num_pieces == 0) {
+        /* Nothing to write, and libuv won't take an empty buffer list; we're
+         * done already. */
+        on_write(wi->req, 0);
+        return;
+    }
+    else if (wi->pieces) {
+        /* A vectored write; libuv takes a copy of the buffer list. */
+        uv_buf_t  *bufs = MVM_malloc(wi->num_pieces * sizeof(uv_buf_t));
+        MVMuint32  i;
+        for (i = 0; i < wi->num_pieces; i++)
+            bufs[i] = uv_buf_init(wi->pieces[i].data, (unsigned int)wi->pieces[i].length);
+        r = uv_write(wi->req, handle_data->handle, bufs, wi->num_pieces, on_write);
+        MVM_free(bufs);
+    }
+    else {
+        /* Extract buf data. */
+        buffer = (MVMArray *)wi->buf_data;
+        output = (char *)(buffer->body.slots.i8 + buffer->body.start);
+        output_size = (int)buffer->body.elems;
+        wi->buf = uv_buf_init(output, output_size);
+        r = uv_write(wi->req, handle_data->handle, &(wi->buf), 1, on_write);
+    }
+
+    if (r < 0) {
         /* Error; need to notify. */
         MVMROOT(tc, async_task, {
             MVMObject    *arr = MVM_repr_alloc_init(tc, tc->instance->boot_types.BOOTArray);
@@ -331,8 +453,12 @@ static void write_gc_mark(MVMThreadContext *tc, void *data, MVMGCWorklist *workl
 
 /* Frees info for a write task. */
 static void write_gc_free(MVMThreadContext *tc, MVMObject *t, void *data) {
-    if (data)
+    if (data) {
+        WriteInfo *wi = (WriteInfo *)data;
+        if (wi->pieces)
+            MVM_io_vec_pieces_free(tc, wi->pieces, wi->num_pieces);
         MVM_free(data);
+    }
 }
 
 /* Operations table for async write task. */
@@ -373,6 +499,53 @@ static MVMAsyncTask * write_bytes(MVMThreadContext *tc, MVMOSHandle *h, MVMObjec
     MVM_ASSIGN_REF(tc, &(task->common.header), wi->handle, h);
     MVM_ASSIGN_REF(tc, &(task->common.header), wi->buf_data, buffer);
     task->body.data = wi;
+    task->body.event_loop = ((MVMIOAsyncSocketData *)h->body.data)->event_loop;
+
+    /* Hand the task off to the event loop. */
+    MVMROOT(tc, task, {
+        MVM_io_eventloop_queue_work(tc, (MVMObject *)task);
+    });
+
+    return task;
+}
+
+static MVMAsyncTask * write_bytes_v(MVMThreadContext *tc, MVMOSHandle *h, MVMObject *queue,
+                                    MVMObject *schedulee, MVMObject *pieces, MVMObject *async_type) {
+    MVMAsyncTask  *task;
+    WriteInfo     *wi;
+    MVMIOVecPiece *vec;
+    MVMuint32      count;
+    MVMuint64      total;
+
+    /* Validate REPRs. */
+    if (REPR(queue)->ID != MVM_REPR_ID_ConcBlockingQueue)
+        MVM_exception_throw_adhoc(tc,
+            "asyncwritebytesv target queue must have ConcBlockingQueue REPR");
+    if (REPR(async_type)->ID != MVM_REPR_ID_MVMAsyncTask)
+        MVM_exception_throw_adhoc(tc,
+            "asyncwritebytesv result type must have REPR AsyncTask");
+
+    /* Create async task handle. */
+    MVMROOT4(tc, queue, schedulee, h, pieces, {
+        task = (MVMAsyncTask *)MVM_repr_alloc_init(tc, async_type);
+    });
+
+    /* Gather the pieces now; strings are encoded here, rather than on the
+     * event loop where an encoding error would have nowhere to go. This does
+     * no GC allocation, and if it throws the task is left to be collected
+     * without ever having owned anything. */
+    vec = MVM_io_vec_pieces(tc, pieces, &count, &total, "asyncwritebytesv");
+    MVM_ASSIGN_REF(tc, &(task->common.header), task->body.queue, queue);
+    MVM_ASSIGN_REF(tc, &(task->common.header), task->body.schedulee, schedulee);
+    task->body.ops   = &write_op_table;
+    wi               = MVM_calloc(1, sizeof(WriteInfo));
+    MVM_ASSIGN_REF(tc, &(task->common.header), wi->handle, h);
+    MVM_ASSIGN_REF(tc, &(task->common.header), wi->buf_data, pieces);
+    wi->pieces       = vec;
+    wi->num_pieces   = count;
+    wi->pieces_total = total;
+    task->body.data  = wi;
+    task->body.event_loop = ((MVMIOAsyncSocketData *)h->body.data)->event_loop;
 
     /* Hand the task off to the event loop. */
     MVMROOT(tc, task, {
@@ -382,6 +555,289 @@ static MVMAsyncTask * write_bytes(MVMThreadContext *tc, MVMOSHandle *h, MVMObjec
     return task;
 }
 
+/* Info we convey about a sendfile task. */
+typedef struct SendfileInfo {
+    MVMOSHandle      *handle;
+    MVMObject        *file;
+    int               file_fd;
+    MVMint64          offset;
+    MVMint64          remaining;
+    MVMint64          sent;
+    uv_write_t       *barrier;
+    struct SendfilePoll *poll;
+    MVMThreadContext *tc;
+    int               work_idx;
+} SendfileInfo;
+
+/* The handle we use to wait for a socket to become writable, along with the
+ * duplicate of the socket's descriptor that it watches. */
+typedef struct SendfilePoll {
+    uv_poll_t handle;
+    int       fd;
+} SendfilePoll;
+
+/* The most to send in one go before giving other handles on the loop a turn. */
+#define SENDFILE_SLICE (1024 * 1024)
+
+#ifndef _WIN32
+/* Sends up to count bytes of a file from the offset to a socket, advancing
+ * the offset; returns the number of bytes sent, 0 at the end of the file,
+ * or -1 with errno set. Uses sendfile where we know its flavour, and falls
+ * back to reading and sending through a buffer elsewhere. */
+static ssize_t send_file_chunk(int sock_fd, int file_fd, MVMint64 *offset, size_t count) {
+#if defined(__linux__)
+    off_t   off = (off_t)*offset;
+    ssize_t r   = sendfile(sock_fd, file_fd, &off, count);
+    if (r > 0)
+        *offset = off;
+    return r;
+#elif defined(__FreeBSD__)
+    off_t sent = 0;
+    int   r    = sendfile(file_fd, sock_fd, (off_t)*offset, count, NULL, &sent, 0);
+    if (sent > 0) {
+        *offset += sent;
+        return sent;
+    }
+    return r < 0 ? -1 : 0;
+#elif defined(__APPLE__)
+    off_t sent = count;
+    int   r    = sendfile(file_fd, sock_fd, (off_t)*offset, &sent, NULL, 0);
+    if (sent > 0) {
+        *offset += sent;
+        return sent;
+    }
+    return r < 0 ? -1 : 0;
+#else
+    char    buf[65536];
+    ssize_t got, r;
+    got = pread(file_fd, buf, count < sizeof(buf) ? count : sizeof(buf), (off_t)*offset);
+    if (got <= 0)
+        return got;
+    r = send(sock_fd, buf, got, 0);
+    if (r > 0)
+        *offset += r;
+    return r;
+#endif
+}
+#endif
+
+/* Closes the watched descriptor and frees the poll handle once it's closed. */
+static void on_sendfile_poll_closed(uv_handle_t *handle) {
+#ifndef _WIN32
+    close(((SendfilePoll *)handle)->fd);
+#endif
+    MVM_free(handle);
+}
+
+/* Stops waiting for the socket to become writable. */
+static void sendfile_stop_poll(SendfileInfo *si) {
+    if (si->poll) {
+        uv_poll_stop(&si->poll->handle);
+        uv_close((uv_handle_t *)&si->poll->handle, on_sendfile_poll_closed);
+        si->poll = NULL;
+    }
+}
+
+/* Reports the outcome of a sendfile task: the number of bytes sent, or an
+ * error. */
+static void sendfile_done(MVMThreadContext *tc, SendfileInfo *si, int status) {
+    MVMIOAsyncSocketData *handle_data = (MVMIOAsyncSocketData *)si->handle->body.data;
+    MVMObject            *arr;
+    MVMAsyncTask         *t;
+    if (handle_data->sendfile == si)
+        handle_data->sendfile = NULL;
+    sendfile_stop_poll(si);
+    arr = MVM_repr_alloc_init(tc, tc->instance->boot_types.BOOTArray);
+    t   = MVM_io_eventloop_get_active_work(tc, si->work_idx);
+    MVM_repr_push_o(tc, arr, t->body.schedulee);
+    if (status >= 0) {
+        MVMROOT2(tc, arr, t, {
+            MVMObject *bytes_box = MVM_repr_box_int(tc,
+                tc->instance->boot_types.BOOTInt, si->sent);
+            MVM_repr_push_o(tc, arr, bytes_box);
+        });
+        MVM_repr_push_o(tc, arr, tc->instance->boot_types.BOOTStr);
+    }
+    else {
+        MVM_repr_push_o(tc, arr, tc->instance->boot_types.BOOTInt);
+        MVMROOT2(tc, arr, t, {
+            MVMString *msg_str = MVM_string_ascii_decode_nt(tc,
+                tc->instance->VMString, uv_strerror(status));
+            MVMObject *msg_box = MVM_repr_box_str(tc,
+                tc->instance->boot_types.BOOTStr, msg_str);
+            MVM_repr_push_o(tc, arr, msg_box);
+        });
+    }
+    MVM_repr_push_o(tc, t->body.queue, arr);
+    MVM_io_eventloop_remove_active_work(tc, &(si->work_idx));
+}
+
+/* Sends as much of the file as the socket takes, whenever it's writable. */
+static void on_sendfile_writable(uv_poll_t *handle, int status, int events) {
+    SendfileInfo     *si   = (SendfileInfo *)handle->data;
+    MVMThreadContext *tc   = si->tc;
+#ifndef _WIN32
+    size_t            done = 0;
+    int               sock_fd;
+    if (status < 0) {
+        sendfile_done(tc, si, status);
+        return;
+    }
+    sock_fd = si->poll->fd;
+    while (si->remaining > 0 && done < SENDFILE_SLICE) {
+        size_t  count = si->remaining < SENDFILE_SLICE - done
+            ? (size_t)si->remaining
+            : SENDFILE_SLICE - done;
+        ssize_t r     = send_file_chunk(sock_fd, si->file_fd, &(si->offset), count);
+        if (r > 0) {
+            si->sent      += r;
+            si->remaining -= r;
+            done          += r;
+        }
+        else if (r == 0) {
+            /* End of the file. */
+            si->remaining = 0;
+        }
+        else if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            /* Wait for the socket to become writable again. */
+            return;
+        }
+        else if (errno != EINTR) {
+            sendfile_done(tc, si, -errno);
+            return;
+        }
+    }
+    if (si->remaining == 0)
+        sendfile_done(tc, si, 0);
+#else
+    sendfile_done(tc, si, UV_ENOTSUP);
+#endif
+}
+
+/* Starts sending once anything written to the socket before is out. We
+ * watch a duplicate of the socket's descriptor for writability, since libuv
+ * does not allow a poll handle on the descriptor a stream handle uses. */
+static void sendfile_start(MVMThreadContext *tc, uv_loop_t *loop, SendfileInfo *si) {
+#ifndef _WIN32
+    MVMIOAsyncSocketData *handle_data = (MVMIOAsyncSocketData *)si->handle->body.data;
+    uv_os_fd_t            fd;
+    int                   poll_fd, r;
+    if (!handle_data->handle || uv_is_closing((uv_handle_t *)handle_data->handle)) {
+        sendfile_done(tc, si, UV_EBADF);
+        return;
+    }
+    if ((r = uv_fileno((uv_handle_t *)handle_data->handle, &fd)) < 0) {
+        sendfile_done(tc, si, r);
+        return;
+    }
+    if ((poll_fd = dup(fd)) < 0) {
+        sendfile_done(tc, si, -errno);
+        return;
+    }
+    si->poll     = MVM_malloc(sizeof(SendfilePoll));
+    si->poll->fd = poll_fd;
+    if ((r = uv_poll_init(loop, &si->poll->handle, poll_fd)) < 0) {
+        close(poll_fd);
+        MVM_free(si->poll);
+        si->poll = NULL;
+        sendfile_done(tc, si, r);
+        return;
+    }
+    si->poll->handle.data = si;
+    if ((r = uv_poll_start(&si->poll->handle, UV_WRITABLE, on_sendfile_writable)) < 0)
+        sendfile_done(tc, si, r);
+#else
+    sendfile_done(tc, si, UV_ENOTSUP);
+#endif
+}
+
+/* Called once earlier writes to the socket are done. */
+static void on_sendfile_barrier(uv_write_t *req, int status) {
+    SendfileInfo *si   = (SendfileInfo *)req->data;
+    uv_loop_t    *loop = req->handle->loop;
+    MVM_free(req);
+    if (!si)
+        return; /* Cancelled. */
+    si->barrier = NULL;
+    if (status < 0)
+        sendfile_done(si->tc, si, status);
+    else
+        sendfile_start(si->tc, loop, si);
+}
+
+/* Does setup work for a sendfile. */
+static void sendfile_setup(MVMThreadContext *tc, uv_loop_t *loop, MVMObject *async_task, void *data) {
+    SendfileInfo         *si          = (SendfileInfo *)data;
+    MVMIOAsyncSocketData *handle_data = (MVMIOAsyncSocketData *)si->handle->body.data;
+    uv_stream_t          *stream      = socket_stream(loop, handle_data);
+
+    /* Add to work in progress. */
+    si->tc       = tc;
+    si->work_idx = MVM_io_eventloop_add_active_work(tc, async_task);
+
+    /* Only one sendfile at a time, or their data would interleave. */
+    if (handle_data->sendfile) {
+        sendfile_done(tc, si, UV_EBUSY);
+        return;
+    }
+    handle_data->sendfile = si;
+
+    /* If writes are still queued on the socket, send an empty write after
+     * them and only start when it completes, so the file data goes out after
+     * theirs. */
+    if (stream && !uv_is_closing((uv_handle_t *)stream) && stream->write_queue_size) {
+        uv_buf_t buf = uv_buf_init("", 0);
+        int      r;
+        si->barrier       = MVM_malloc(sizeof(uv_write_t));
+        si->barrier->data = si;
+        if ((r = uv_write(si->barrier, stream, &buf, 1, on_sendfile_barrier)) < 0) {
+            MVM_free(si->barrier);
+            si->barrier = NULL;
+            sendfile_done(tc, si, r);
+        }
+        return;
+    }
+    sendfile_start(tc, loop, si);
+}
+
+/* Stops sending. */
+static void sendfile_cancel(MVMThreadContext *tc, uv_loop_t *loop, MVMObject *async_task, void *data) {
+    SendfileInfo *si = (SendfileInfo *)data;
+    if (si->work_idx >= 0) {
+        MVMIOAsyncSocketData *handle_data = (MVMIOAsyncSocketData *)si->handle->body.data;
+        if (handle_data->sendfile == si)
+            handle_data->sendfile = NULL;
+        if (si->barrier) {
+            si->barrier->data = NULL;
+            si->barrier       = NULL;
+        }
+        sendfile_stop_poll(si);
+        MVM_io_eventloop_remove_active_work(tc, &(si->work_idx));
+    }
+}
+
+/* Marks objects for a sendfile task. */
+static void sendfile_gc_mark(MVMThreadContext *tc, void *data, MVMGCWorklist *worklist) {
+    SendfileInfo *si = (SendfileInfo *)data;
+    MVM_gc_worklist_add(tc, worklist, &si->handle);
+    MVM_gc_worklist_add(tc, worklist, &si->file);
+}
+
+/* Frees info for a sendfile task. */
+static void sendfile_gc_free(MVMThreadContext *tc, MVMObject *t, void *data) {
+    if (data)
+        MVM_free(data);
+}
+
+/* Operations table for async sendfile task. */
+static const MVMAsyncTaskOps sendfile_op_table = {
+    sendfile_setup,
+    NULL,
+    sendfile_cancel,
+    sendfile_gc_mark,
+    sendfile_gc_free
+};
+
 /* Info we convey about a socket close task. */
 typedef struct {
     MVMOSHandle *handle;
@@ -391,7 +847,12 @@ typedef struct {
 static void close_perform(MVMThreadContext *tc, uv_loop_t *loop, MVMObject *async_task, void *data) {
     CloseInfo *ci = (CloseInfo *)data;
     MVMIOAsyncSocketData *handle_data = (MVMIOAsyncSocketData *)ci->handle->body.data;
-    uv_handle_t *handle = (uv_handle_t *)handle_data->handle;
+    uv_handle_t *handle = (uv_handle_t *)socket_stream(loop, handle_data);
+    /* A sendfile that is sending holds a duplicate of the descriptor, which
+     * would keep the connection open; end it. One still waiting for earlier
+     * writes ends when closing the socket cancels them. */
+    if (handle_data->sendfile && handle_data->sendfile->poll)
+        sendfile_done(tc, handle_data->sendfile, UV_ECANCELED);
     if (handle && !uv_is_closing(handle)) {
         handle_data->handle = NULL;
         uv_close(handle, free_on_close_cb);
@@ -431,6 +892,7 @@ static MVMint64 close_socket(MVMThreadContext *tc, MVMOSHandle *h) {
     ci = MVM_calloc(1, sizeof(CloseInfo));
     MVM_ASSIGN_REF(tc, &(task->common.header), ci->handle, h);
     task->body.data = ci;
+    task->body.event_loop = ((MVMIOAsyncSocketData *)h->body.data)->event_loop;
     MVM_io_eventloop_queue_work(tc, (MVMObject *)task);
 
     return 0;
@@ -439,6 +901,8 @@ static MVMint64 close_socket(MVMThreadContext *tc, MVMOSHandle *h) {
 static MVMint64 socket_is_tty(MVMThreadContext *tc, MVMOSHandle *h) {
     MVMIOAsyncSocketData *data   = (MVMIOAsyncSocketData *)h->body.data;
     uv_handle_t          *handle = (uv_handle_t *)data->handle;
+    if (data->pending)
+        return 0;
     return (MVMint64)(handle->type == UV_TTY);
 }
 
@@ -448,6 +912,9 @@ static MVMint64 socket_handle(MVMThreadContext *tc, MVMOSHandle *h) {
     int        fd;
     uv_os_fd_t fh;
 
+    if (data->pending)
+        return (MVMint64)data->pending_fd;
+
     uv_fileno(handle, &fh);
     fd = uv_open_osfhandle(fh);
     return (MVMint64)fd;
@@ -456,7 +923,7 @@ static MVMint64 socket_handle(MVMThreadContext *tc, MVMOSHandle *h) {
 /* IO ops table, populated with functions. */
 static const MVMIOClosable      closable       = { close_socket };
 static const MVMIOAsyncReadable async_readable = { read_bytes };
-static const MVMIOAsyncWritable async_writable = { write_bytes };
+static const MVMIOAsyncWritable async_writable = { write_bytes, write_bytes_v };
 static const MVMIOIntrospection introspection  = { socket_is_tty,
                                                    socket_handle };
 static const MVMIOOps op_table = {
@@ -534,6 +1001,7 @@ static void on_connect(uv_connect_t* req, int status) {
             MVMOSHandle          *result = (MVMOSHandle *)MVM_repr_alloc_init(tc, tc->instance->boot_types.BOOTIO);
             MVMIOAsyncSocketData *data   = MVM_calloc(1, sizeof(MVMIOAsyncSocketData));
             data->handle                 = (uv_stream_t *)ci->socket;
+            data->event_loop             = tc->event_loop;
             result->body.ops             = &op_table;
             result->body.data            = data;
             MVM_repr_push_o(tc, arr, (MVMObject *)result);
@@ -677,8 +1145,29 @@ typedef struct {
     MVMThreadContext *tc;
     int               work_idx;
     int               backlog;
+
+    /* Whether the listener shares its address with others (SO_REUSEPORT),
+     * leaving the distribution of connections to the kernel. */
+    int               shared;
 } ListenInfo;
 
+/* Lets a socket share its address with other sockets, so the kernel spreads
+ * the incoming connections over them. */
+static int set_reuseport(uv_tcp_t *socket) {
+#ifdef SO_REUSEPORT
+    uv_os_fd_t fd;
+    int        on = 1;
+    int        r;
+    if ((r = uv_fileno((uv_handle_t *)socket, &fd)) < 0)
+        return r;
+    if (setsockopt(fd, SOL_SOCKET, SO_REUSEPORT, (const void *)&on, sizeof(on)) < 0)
+        return -errno;
+    return 0;
+#else
+    return UV_ENOTSUP;
+#endif
+}
+
 
 /* Handles an incoming connection. */
 static void on_connection(uv_stream_t *server, int status) {
@@ -697,11 +1186,14 @@ static void on_connection(uv_stream_t *server, int status) {
         MVMROOT2(tc, arr, t, {
             struct sockaddr_storage sockaddr;
             int name_len = sizeof(struct sockaddr_storage);
+            MVMIOAsyncSocketData *client_data;
 
             {
                 MVMOSHandle          *result = (MVMOSHandle *)MVM_repr_alloc_init(tc, tc->instance->boot_types.BOOTIO);
                 MVMIOAsyncSocketData *data   = MVM_calloc(1, sizeof(MVMIOAsyncSocketData));
+                client_data                  = data;
                 data->handle                 = (uv_stream_t *)client;
+                data->event_loop             = tc->event_loop;
                 result->body.ops             = &op_table;
                 result->body.data            = data;
 
@@ -716,6 +1208,7 @@ static void on_connection(uv_stream_t *server, int status) {
                 MVMOSHandle          *result = (MVMOSHandle *)MVM_repr_alloc_init(tc, tc->instance->boot_types.BOOTIO);
                 MVMIOAsyncSocketData *data   = MVM_calloc(1, sizeof(MVMIOAsyncSocketData));
                 data->handle                 = (uv_stream_t *)li->socket;
+                data->event_loop             = tc->event_loop;
                 result->body.ops             = &op_table;
                 result->body.data            = data;
 
@@ -724,6 +1217,11 @@ static void on_connection(uv_stream_t *server, int status) {
                 uv_tcp_getsockname(client, (struct sockaddr *)&sockaddr, &name_len);
                 push_name_and_port(tc, &sockaddr, arr);
             }
+
+            /* Spread connections over the event loops, unless the kernel
+             * already does so over listeners on different loops. */
+            if (!li->shared)
+                hand_off_connection(tc, client_data);
         });
     }
     else {
@@ -758,7 +1256,8 @@ static void listen_setup(MVMThreadContext *tc, uv_loop_t *loop, MVMObject *async
     /* Create and initialize socket and connection, and start listening. */
     li->socket        = MVM_malloc(sizeof(uv_tcp_t));
     li->socket->data  = data;
-    if ((r = uv_tcp_init(loop, li->socket)) < 0 ||
+    if ((r = uv_tcp_init_ex(loop, li->socket, li->dest->sa_family)) < 0 ||
+        (li->shared && (r = set_reuseport(li->socket)) < 0) ||
         (r = uv_tcp_bind(li->socket, li->dest, 0)) < 0 ||
         (r = uv_listen((uv_stream_t *)li->socket, li->backlog, on_connection))) {
         /* Error; need to notify. */
@@ -805,6 +1304,7 @@ static void listen_setup(MVMThreadContext *tc, uv_loop_t *loop, MVMObject *async
                 MVMOSHandle          *result = (MVMOSHandle *)MVM_repr_alloc_init(tc, tc->instance->boot_types.BOOTIO);
                 MVMIOAsyncSocketData *data   = MVM_calloc(1, sizeof(MVMIOAsyncSocketData));
                 data->handle                 = (uv_stream_t *)li->socket;
+                data->event_loop             = tc->event_loop;
                 result->body.ops             = &op_table;
                 result->body.data            = data;
 
@@ -854,9 +1354,9 @@ static const MVMAsyncTaskOps listen_op_table = {
 };
 
 /* Initiates an async socket listener. */
-MVMObject * MVM_io_socket_listen_async(MVMThreadContext *tc, MVMObject *queue,
-                                       MVMObject *schedulee, MVMString *host,
-                                       MVMint64 port, MVMint32 backlog, MVMObject *async_type) {
+static MVMObject * listen_async(MVMThreadContext *tc, MVMObject *queue,
+                                MVMObject *schedulee, MVMString *host, MVMint64 port,
+                                MVMint32 backlog, MVMObject *async_type, int shared) {
     MVMAsyncTask *task;
     ListenInfo   *li;
     struct sockaddr *dest;
@@ -884,6 +1384,7 @@ MVMObject * MVM_io_socket_listen_async(MVMThreadContext *tc, MVMObject *queue,
     li              = MVM_calloc(1, sizeof(ListenInfo));
     li->dest        = dest;
     li->backlog     = backlog;
+    li->shared      = shared;
     task->body.data = li;
 
     /* Hand the task off to the event loop. */
@@ -893,3 +1394,80 @@ MVMObject * MVM_io_socket_listen_async(MVMThreadContext *tc, MVMObject *queue,
 
     return (MVMObject *)task;
 }
+MVMObject * MVM_io_socket_listen_async(MVMThreadContext *tc, MVMObject *queue,
+                                       MVMObject *schedulee, MVMString *host,
+                                       MVMint64 port, MVMint32 backlog, MVMObject *async_type) {
+    return listen_async(tc, queue, schedulee, host, port, backlog, async_type, 0);
+}
+
+/* Initiates an async socket listener that shares its address with any other
+ * such listeners (using SO_REUSEPORT), having the kernel distribute incoming
+ * connections over them. Each listener is a task of its own, so runs on an
+ * event loop of its own (as far as there are loops) and can deliver to a
+ * queue of its own. */
+MVMObject * MVM_io_socket_listen_shared_async(MVMThreadContext *tc, MVMObject *queue,
+                                              MVMObject *schedulee, MVMString *host,
+                                              MVMint64 port, MVMint32 backlog, MVMObject *async_type) {
+    return listen_async(tc, queue, schedulee, host, port, backlog, async_type, 1);
+}
+
+/* Sends length bytes of a file, starting at offset, to a socket, without
+ * copying them through user space; a negative length sends up to the end of
+ * the file. The file must stay open until the task reports completion, which
+ * it does like a write: with the number of bytes sent, or an error. Writes
+ * queued before the sendfile go out ahead of the file data, but writes
+ * queued after it are not held back and may be interleaved with it, so they
+ * should wait for its completion. Only one sendfile may be in progress on a
+ * socket at a time; another fails. Closing the socket ends the sendfile with
+ * an error. */
+MVMObject * MVM_io_socket_sendfile_async(MVMThreadContext *tc, MVMObject *queue,
+                                         MVMObject *schedulee, MVMObject *socket, MVMObject *file,
+                                         MVMint64 offset, MVMint64 length, MVMObject *async_type) {
+    MVMAsyncTask *task;
+    SendfileInfo *si;
+    MVMint64      file_fd;
+
+    /* Validate REPRs. */
+    if (REPR(queue)->ID != MVM_REPR_ID_ConcBlockingQueue)
+        MVM_exception_throw_adhoc(tc,
+            "asyncsendfile target queue must have ConcBlockingQueue REPR");
+    if (REPR(async_type)->ID != MVM_REPR_ID_MVMAsyncTask)
+        MVM_exception_throw_adhoc(tc,
+            "asyncsendfile result type must have REPR AsyncTask");
+    if (REPR(socket)->ID != MVM_REPR_ID_MVMOSHandle || !IS_CONCRETE(socket)
+            || ((MVMOSHandle *)socket)->body.ops != &op_table)
+        MVM_exception_throw_adhoc(tc, "asyncsendfile requires an asynchronous socket to send to");
+#ifdef _WIN32
+    MVM_exception_throw_adhoc(tc, "asyncsendfile is not supported on this platform");
+#endif
+    if (offset < 0)
+        MVM_exception_throw_adhoc(tc, "asyncsendfile offset must not be negative");
+    MVMROOT4(tc, queue, schedulee, socket, async_type, {
+        file_fd = MVM_io_fileno(tc, file);
+    });
+    if (file_fd < 0)
+        MVM_exception_throw_adhoc(tc, "asyncsendfile requires a file handle to send from");
+
+    /* Create async task handle. */
+    MVMROOT4(tc, queue, schedulee, socket, file, {
+        task = (MVMAsyncTask *)MVM_repr_alloc_init(tc, async_type);
+    });
+    MVM_ASSIGN_REF(tc, &(task->common.header), task->body.queue, queue);
+    MVM_ASSIGN_REF(tc, &(task->common.header), task->body.schedulee, schedulee);
+    task->body.ops  = &sendfile_op_table;
+    si              = MVM_calloc(1, sizeof(SendfileInfo));
+    MVM_ASSIGN_REF(tc, &(task->common.header), si->handle, socket);
+    MVM_ASSIGN_REF(tc, &(task->common.header), si->file, file);
+    si->file_fd     = (int)file_fd;
+    si->offset      = offset;
+    si->remaining   = length < 0 ? INT64_MAX : length;
+    task->body.data = si;
+    task->body.event_loop = ((MVMIOAsyncSocketData *)((MVMOSHandle *)socket)->body.data)->event_loop;
+
+    /* Hand the task off to the event loop. */
+    MVMROOT(tc, task, {
+        MVM_io_eventloop_queue_work(tc, (MVMObject *)task);
+    });
+
+    return (MVMObject *)task;
+}
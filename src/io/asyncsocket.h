@@ -2,3 +2,8 @@ MVMObject * MVM_io_socket_connect_async(MVMThreadContext *tc, MVMObject *queue,
     MVMObject *schedulee, MVMString *host, MVMint64 port, MVMObject *async_type);
 MVMObject * MVM_io_socket_listen_async(MVMThreadContext *tc, MVMObject *queue,
     MVMObject *schedulee, MVMString *host, MVMint64 port, MVMint32 backlog, MVMObject *async_type);
+MVMObject * MVM_io_socket_listen_shared_async(MVMThreadContext *tc, MVMObject *queue,
+    MVMObject *schedulee, MVMString *host, MVMint64 port, MVMint32 backlog, MVMObject *async_type);
+MVMObject * MVM_io_socket_sendfile_async(MVMThreadContext *tc, MVMObject *queue,
+    MVMObject *schedulee, MVMObject *socket, MVMObject *file, MVMint64 offset,
+    MVMint64 length, MVMObject *async_type);
@@ -1,21 +1,33 @@
 #include "moar.h"
 
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
 /* Number of bytes we accept per read. */
 #define CHUNK_SIZE 65536
 
-/* Data that we keep for an asynchronous UDP socket handle. */
+/* Data that we keep for an asynchronous UDP socket handle. The libuv handle's
+ * data points back to it. */
 typedef struct {
     /* The libuv handle to the socket. */
     uv_udp_t *handle;
+
+    /* The read, plain or batched, going on; there can only be one at a time. */
+    struct ReadInfo *reading;
+
+    /* The event loop the socket lives on; all work on it is done there. */
+    MVMIOEventLoop *event_loop;
 } MVMIOAsyncUDPSocketData;
 
 /* Info we convey about a read task. */
-typedef struct {
+typedef struct ReadInfo {
     MVMOSHandle      *handle;
     MVMObject        *buf_type;
     int               seq_number;
     MVMThreadContext *tc;
     int               work_idx;
+    struct BatchRecv *batch;
 } ReadInfo;
 
 /* Allocates a buffer of the suggested size. */
@@ -74,10 +86,11 @@ static void push_name_and_port(MVMThreadContext *tc, struct sockaddr_storage *na
 
 /* Read handler. */
 static void on_read(uv_udp_t *handle, ssize_t nread, const uv_buf_t *buf, const struct sockaddr *addr, unsigned flags) {
-    ReadInfo         *ri  = (ReadInfo *)handle->data;
-    MVMThreadContext *tc  = ri->tc;
-    MVMObject        *arr;
-    MVMAsyncTask     *t;
+    MVMIOAsyncUDPSocketData *handle_data = (MVMIOAsyncUDPSocketData *)handle->data;
+    ReadInfo                *ri          = handle_data->reading;
+    MVMThreadContext        *tc          = ri->tc;
+    MVMObject               *arr;
+    MVMAsyncTask            *t;
 
     /* libuv will call on_read once after all datagram read operations
      * to "give us back a buffer". in that case, nread and addr are NULL.
@@ -128,6 +141,7 @@ static void on_read(uv_udp_t *handle, ssize_t nread, const uv_buf_t *buf, const
         if (buf->base)
             MVM_free(buf->base);
         uv_udp_recv_stop(handle);
+        handle_data->reading = NULL;
         MVM_io_eventloop_remove_active_work(tc, &(ri->work_idx));
     }
     else {
@@ -145,6 +159,7 @@ static void on_read(uv_udp_t *handle, ssize_t nread, const uv_buf_t *buf, const
         if (buf->base)
             MVM_free(buf->base);
         uv_udp_recv_stop(handle);
+        handle_data->reading = NULL;
         MVM_io_eventloop_remove_active_work(tc, &(ri->work_idx));
     }
     MVM_repr_push_o(tc, t->body.queue, arr);
@@ -160,10 +175,13 @@ static void read_setup(MVMThreadContext *tc, uv_loop_t *loop, MVMObject *async_t
     ri->tc        = tc;
     ri->work_idx  = MVM_io_eventloop_add_active_work(tc, async_task);
 
-    /* Start reading the stream. */
+    /* Start reading the stream, unless it's being read already. */
     handle_data = (MVMIOAsyncUDPSocketData *)ri->handle->body.data;
-    handle_data->handle->data = data;
-    if ((r = uv_udp_recv_start(handle_data->handle, on_alloc, on_read)) < 0) {
+    if (handle_data->reading)
+        r = UV_EBUSY;
+    else if ((r = uv_udp_recv_start(handle_data->handle, on_alloc, on_read)) >= 0)
+        handle_data->reading = ri;
+    if (r < 0) {
         /* Error; need to notify. */
         MVMROOT(tc, async_task, {
             MVMObject    *arr = MVM_repr_alloc_init(tc, tc->instance->boot_types.BOOTArray);
@@ -179,6 +197,7 @@ static void read_setup(MVMThreadContext *tc, uv_loop_t *loop, MVMObject *async_t
             });
             MVM_repr_push_o(tc, ((MVMAsyncTask *)async_task)->body.queue, arr);
         });
+        MVM_io_eventloop_remove_active_work(tc, &(ri->work_idx));
     }
 }
 
@@ -237,6 +256,7 @@ static MVMAsyncTask * read_bytes(MVMThreadContext *tc, MVMOSHandle *h, MVMObject
     MVM_ASSIGN_REF(tc, &(task->common.header), ri->buf_type, buf_type);
     MVM_ASSIGN_REF(tc, &(task->common.header), ri->handle, h);
     task->body.data = ri;
+    task->body.event_loop = ((MVMIOAsyncUDPSocketData *)h->body.data)->event_loop;
 
     /* Hand the task off to the event loop. */
     MVMROOT(tc, task, {
@@ -399,6 +419,7 @@ static MVMAsyncTask * write_bytes_to(MVMThreadContext *tc, MVMOSHandle *h, MVMOb
     MVM_ASSIGN_REF(tc, &(task->common.header), wi->buf_data, buffer);
     wi->dest_addr = dest_addr;
     task->body.data = wi;
+    task->body.event_loop = ((MVMIOAsyncUDPSocketData *)h->body.data)->event_loop;
 
     /* Hand the task off to the event loop. */
     MVMROOT(tc, task, {
@@ -408,13 +429,410 @@ static MVMAsyncTask * write_bytes_to(MVMThreadContext *tc, MVMOSHandle *h, MVMOb
     return task;
 }
 
+/* Number of datagrams read or sent with one system call in batched mode. */
+#define BATCH_SIZE 32
+
+/* State of a batched read: the handle we use to wait for the socket to be
+ * readable, along with the duplicate of the socket's descriptor it watches,
+ * and room to receive a batch of datagrams into. */
+typedef struct BatchRecv {
+    uv_poll_t                handle;
+    int                      fd;
+    char                    *area;
+    size_t                   lengths[BATCH_SIZE];
+    struct sockaddr_storage  addrs[BATCH_SIZE];
+} BatchRecv;
+
+static void on_batch_poll_closed(uv_handle_t *handle) {
+    BatchRecv *br = (BatchRecv *)handle;
+#ifndef _WIN32
+    close(br->fd);
+#endif
+    MVM_free(br->area);
+    MVM_free(br);
+}
+
+/* Stops a batched read, if it is still going. */
+static void batch_read_stop(MVMThreadContext *tc, ReadInfo *ri) {
+    if (ri->batch) {
+        MVMIOAsyncUDPSocketData *handle_data = (MVMIOAsyncUDPSocketData *)ri->handle->body.data;
+        if (handle_data->reading == ri)
+            handle_data->reading = NULL;
+        uv_poll_stop(&ri->batch->handle);
+        uv_close((uv_handle_t *)&ri->batch->handle, on_batch_poll_closed);
+        ri->batch = NULL;
+        MVM_io_eventloop_remove_active_work(tc, &(ri->work_idx));
+    }
+}
+
+#ifndef _WIN32
+/* Receives as many datagrams as are waiting, up to a batch; returns how many
+ * that was, or -1 with errno set. */
+static int receive_batch(BatchRecv *br) {
+    int n = 0;
+#if defined(__linux__) || defined(__FreeBSD__)
+    struct mmsghdr msgs[BATCH_SIZE];
+    struct iovec   iovs[BATCH_SIZE];
+    int            i;
+    memset(msgs, 0, sizeof(msgs));
+    for (i = 0; i < BATCH_SIZE; i++) {
+        iovs[i].iov_base             = br->area + (size_t)i * CHUNK_SIZE;
+        iovs[i].iov_len              = CHUNK_SIZE;
+        msgs[i].msg_hdr.msg_name     = &br->addrs[i];
+        msgs[i].msg_hdr.msg_namelen  = sizeof(struct sockaddr_storage);
+        msgs[i].msg_hdr.msg_iov      = &iovs[i];
+        msgs[i].msg_hdr.msg_iovlen   = 1;
+    }
+    do {
+        n = recvmmsg(br->fd, msgs, BATCH_SIZE, MSG_DONTWAIT, NULL);
+    } while (n == -1 && errno == EINTR);
+    for (i = 0; i < n; i++)
+        br->lengths[i] = msgs[i].msg_len;
+#else
+    /* No recvmmsg; at least deliver what is waiting as one batch. */
+    while (n < BATCH_SIZE) {
+        socklen_t addr_len = sizeof(struct sockaddr_storage);
+        ssize_t   r;
+        do {
+            r = recvfrom(br->fd, br->area + (size_t)n * CHUNK_SIZE, CHUNK_SIZE, MSG_DONTWAIT,
+                (struct sockaddr *)&br->addrs[n], &addr_len);
+        } while (r == -1 && errno == EINTR);
+        if (r == -1) {
+            if (n == 0)
+                return -1;
+            break;
+        }
+        br->lengths[n++] = (size_t)r;
+    }
+#endif
+    return n;
+}
+#endif
+
+/* Called when the socket has datagrams waiting in batched mode; delivers
+ * [schedulee, sequence number, records, error], where the records are a
+ * flat array of buffer, host and port for each datagram. */
+static void on_batch_readable(uv_poll_t *handle, int status, int events) {
+    ReadInfo         *ri = (ReadInfo *)handle->data;
+    MVMThreadContext *tc = ri->tc;
+    MVMAsyncTask     *t  = MVM_io_eventloop_get_active_work(tc, ri->work_idx);
+    MVMObject        *arr;
+    int               n = -1;
+
+#ifndef _WIN32
+    if (status >= 0) {
+        n = receive_batch(ri->batch);
+        if (n == 0 || (n == -1 && (errno == EAGAIN || errno == EWOULDBLOCK)))
+            return;
+        if (n == -1)
+            status = -errno;
+    }
+#endif
+
+    arr = MVM_repr_alloc_init(tc, tc->instance->boot_types.BOOTArray);
+    MVM_repr_push_o(tc, arr, t->body.schedulee);
+    if (n > 0) {
+        MVMROOT2(tc, t, arr, {
+            MVMObject *records;
+            MVMObject *seq_boxed = MVM_repr_box_int(tc,
+                tc->instance->boot_types.BOOTInt, ri->seq_number++);
+            MVM_repr_push_o(tc, arr, seq_boxed);
+            records = MVM_repr_alloc_init(tc, tc->instance->boot_types.BOOTArray);
+            MVM_repr_push_o(tc, arr, records);
+            MVMROOT(tc, records, {
+                int i;
+                for (i = 0; i < n; i++) {
+                    /* Copy each datagram out, as most are far smaller than
+                     * the room we receive them into. */
+                    size_t    len     = ri->batch->lengths[i];
+                    MVMArray *res_buf = (MVMArray *)MVM_repr_alloc_init(tc, ri->buf_type);
+                    res_buf->body.slots.i8 = MVM_malloc(len ? len : 1);
+                    memcpy(res_buf->body.slots.i8, ri->batch->area + (size_t)i * CHUNK_SIZE, len);
+                    res_buf->body.start    = 0;
+                    res_buf->body.ssize    = len;
+                    res_buf->body.elems    = len;
+                    MVM_repr_push_o(tc, records, (MVMObject *)res_buf);
+                    push_name_and_port(tc, &ri->batch->addrs[i], records);
+                }
+            });
+            MVM_repr_push_o(tc, arr, tc->instance->boot_types.BOOTStr);
+        });
+    }
+    else {
+        MVM_repr_push_o(tc, arr, tc->instance->boot_types.BOOTInt);
+        MVM_repr_push_o(tc, arr, tc->instance->boot_types.BOOTArray);
+        MVMROOT2(tc, t, arr, {
+            MVMString *msg_str = MVM_string_ascii_decode_nt(tc,
+                tc->instance->VMString, uv_strerror(status));
+            MVMObject *msg_box = MVM_repr_box_str(tc,
+                tc->instance->boot_types.BOOTStr, msg_str);
+            MVM_repr_push_o(tc, arr, msg_box);
+        });
+        batch_read_stop(tc, ri);
+    }
+    MVM_repr_push_o(tc, t->body.queue, arr);
+}
+
+/* Does setup work for a batched read: watches a duplicate of the socket's
+ * descriptor for datagrams, which are then read with recvmmsg. */
+static void batch_read_setup(MVMThreadContext *tc, uv_loop_t *loop, MVMObject *async_task, void *data) {
+    ReadInfo                *ri          = (ReadInfo *)data;
+    MVMIOAsyncUDPSocketData *handle_data = (MVMIOAsyncUDPSocketData *)ri->handle->body.data;
+    int                      r           = UV_ENOTSUP;
+#ifndef _WIN32
+    uv_os_fd_t               fd;
+    int                      poll_fd = -1;
+#endif
+
+    ri->tc       = tc;
+    ri->work_idx = MVM_io_eventloop_add_active_work(tc, async_task);
+
+#ifndef _WIN32
+    if (uv_is_closing((uv_handle_t *)handle_data->handle))
+        r = UV_EBADF;
+    else if (handle_data->reading)
+        r = UV_EBUSY;
+    else if ((r = uv_fileno((uv_handle_t *)handle_data->handle, &fd)) >= 0
+            && (poll_fd = dup(fd)) < 0)
+        r = -errno;
+    if (r >= 0) {
+        BatchRecv *br = MVM_calloc(1, sizeof(BatchRecv));
+        br->fd = poll_fd;
+        if ((r = uv_poll_init(loop, &br->handle, poll_fd)) < 0) {
+            close(poll_fd);
+            MVM_free(br);
+        }
+        else {
+            br->area        = MVM_malloc((size_t)BATCH_SIZE * CHUNK_SIZE);
+            br->handle.data = ri;
+            ri->batch       = br;
+            handle_data->reading = ri;
+            if ((r = uv_poll_start(&br->handle, UV_READABLE, on_batch_readable)) >= 0)
+                return;
+        }
+    }
+#endif
+
+    /* Error; need to notify. */
+    MVMROOT(tc, async_task, {
+        MVMObject *arr = MVM_repr_alloc_init(tc, tc->instance->boot_types.BOOTArray);
+        MVM_repr_push_o(tc, arr, ((MVMAsyncTask *)async_task)->body.schedulee);
+        MVM_repr_push_o(tc, arr, tc->instance->boot_types.BOOTInt);
+        MVM_repr_push_o(tc, arr, tc->instance->boot_types.BOOTArray);
+        MVMROOT(tc, arr, {
+            MVMString *msg_str = MVM_string_ascii_decode_nt(tc,
+                tc->instance->VMString, uv_strerror(r));
+            MVMObject *msg_box = MVM_repr_box_str(tc,
+                tc->instance->boot_types.BOOTStr, msg_str);
+            MVM_repr_push_o(tc, arr, msg_box);
+        });
+        MVM_repr_push_o(tc, ((MVMAsyncTask *)async_task)->body.queue, arr);
+    });
+    if (ri->batch)
+        batch_read_stop(tc, ri);
+    else
+        MVM_io_eventloop_remove_active_work(tc, &(ri->work_idx));
+}
+
+/* Stops a batched read. */
+static void batch_read_cancel(MVMThreadContext *tc, uv_loop_t *loop, MVMObject *async_task, void *data) {
+    batch_read_stop(tc, (ReadInfo *)data);
+}
+
+/* Operations table for async batched read task. */
+static const MVMAsyncTaskOps batch_read_op_table = {
+    batch_read_setup,
+    NULL,
+    batch_read_cancel,
+    read_gc_mark,
+    read_gc_free
+};
+
+/* Info we convey about a batched send task. The records are a flat array of
+ * buffer, host and port for each datagram; the destinations were resolved
+ * when the task was created, with runs of records to the same host and port
+ * sharing one. */
+typedef struct {
+    MVMOSHandle       *handle;
+    MVMObject         *records;
+    struct sockaddr  **dests;
+    MVMuint32          count;
+    MVMuint32          sent;
+    MVMuint32          outstanding;
+    int                error;
+    MVMThreadContext  *tc;
+    int                work_idx;
+} BatchSendInfo;
+
+/* Reports the outcome of a batched send: [schedulee, datagrams sent,
+ * error]. */
+static void batch_send_done(MVMThreadContext *tc, BatchSendInfo *bi) {
+    MVMAsyncTask *t   = MVM_io_eventloop_get_active_work(tc, bi->work_idx);
+    MVMObject    *arr = MVM_repr_alloc_init(tc, tc->instance->boot_types.BOOTArray);
+    MVM_repr_push_o(tc, arr, t->body.schedulee);
+    MVMROOT2(tc, arr, t, {
+        MVMObject *sent_box = MVM_repr_box_int(tc,
+            tc->instance->boot_types.BOOTInt, bi->sent);
+        MVM_repr_push_o(tc, arr, sent_box);
+        if (bi->error) {
+            MVMString *msg_str = MVM_string_ascii_decode_nt(tc,
+                tc->instance->VMString, uv_strerror(bi->error));
+            MVMObject *msg_box = MVM_repr_box_str(tc,
+                tc->instance->boot_types.BOOTStr, msg_str);
+            MVM_repr_push_o(tc, arr, msg_box);
+        }
+        else {
+            MVM_repr_push_o(tc, arr, tc->instance->boot_types.BOOTStr);
+        }
+    });
+    MVM_repr_push_o(tc, t->body.queue, arr);
+    MVM_io_eventloop_remove_active_work(tc, &(bi->work_idx));
+}
+
+/* Completion handler for a datagram of a batch that went through libuv's
+ * send queue. */
+static void on_batch_sent(uv_udp_send_t *req, int status) {
+    BatchSendInfo *bi = (BatchSendInfo *)req->data;
+    MVM_free(req);
+    if (status < 0) {
+        if (!bi->error)
+            bi->error = status;
+    }
+    else {
+        bi->sent++;
+    }
+    if (--bi->outstanding == 0)
+        batch_send_done(bi->tc, bi);
+}
+
+/* Gets the data of the buffer of a record in a batch. */
+static uv_buf_t batch_record_buf(MVMThreadContext *tc, BatchSendInfo *bi, MVMuint32 i) {
+    MVMArray *buffer = (MVMArray *)MVM_repr_at_pos_o(tc, bi->records, (MVMint64)i * 3);
+    return uv_buf_init((char *)(buffer->body.slots.i8 + buffer->body.start),
+        (unsigned int)buffer->body.elems);
+}
+
+/* Does setup work for a batched send. If nothing is queued up on the socket
+ * already, as much as possible is sent right away with sendmmsg; whatever
+ * is left goes through libuv's send queue. */
+static void batch_send_setup(MVMThreadContext *tc, uv_loop_t *loop, MVMObject *async_task, void *data) {
+    BatchSendInfo           *bi          = (BatchSendInfo *)data;
+    MVMIOAsyncUDPSocketData *handle_data = (MVMIOAsyncUDPSocketData *)bi->handle->body.data;
+    MVMuint32                i = 0;
+
+    bi->tc       = tc;
+    bi->work_idx = MVM_io_eventloop_add_active_work(tc, async_task);
+
+    if (uv_is_closing((uv_handle_t *)handle_data->handle)) {
+        bi->error = UV_EBADF;
+        batch_send_done(tc, bi);
+        return;
+    }
+
+#if defined(__linux__) || defined(__FreeBSD__)
+    if (handle_data->handle->send_queue_count == 0) {
+        uv_os_fd_t fd;
+        if (uv_fileno((uv_handle_t *)handle_data->handle, &fd) >= 0) {
+            struct mmsghdr msgs[BATCH_SIZE];
+            struct iovec   iovs[BATCH_SIZE];
+            while (i < bi->count) {
+                MVMuint32 n = 0;
+                int       r;
+                memset(msgs, 0, sizeof(msgs));
+                for (; n < BATCH_SIZE && i + n < bi->count; n++) {
+                    uv_buf_t buf = batch_record_buf(tc, bi, i + n);
+                    struct sockaddr *dest = bi->dests[i + n];
+                    iovs[n].iov_base            = buf.base;
+                    iovs[n].iov_len             = buf.len;
+                    msgs[n].msg_hdr.msg_name    = dest;
+                    msgs[n].msg_hdr.msg_namelen = dest->sa_family == AF_INET6
+                        ? sizeof(struct sockaddr_in6)
+                        : sizeof(struct sockaddr_in);
+                    msgs[n].msg_hdr.msg_iov     = &iovs[n];
+                    msgs[n].msg_hdr.msg_iovlen  = 1;
+                }
+                do {
+                    r = sendmmsg(fd, msgs, n, MSG_DONTWAIT);
+                } while (r == -1 && errno == EINTR);
+                if (r == -1) {
+                    /* If the socket is full, the send queue takes over. */
+                    if (errno != EAGAIN && errno != EWOULDBLOCK)
+                        bi->error = -errno;
+                    break;
+                }
+                i        += r;
+                bi->sent += r;
+            }
+        }
+    }
+#endif
+
+    /* Send whatever is left one datagram at a time. */
+    for (; i < bi->count && !bi->error; i++) {
+        uv_udp_send_t *req = MVM_malloc(sizeof(uv_udp_send_t));
+        uv_buf_t       buf = batch_record_buf(tc, bi, i);
+        int            r;
+        req->data = bi;
+        if ((r = uv_udp_send(req, handle_data->handle, &buf, 1, bi->dests[i], on_batch_sent)) < 0) {
+            MVM_free(req);
+            bi->error = r;
+        }
+        else {
+            bi->outstanding++;
+        }
+    }
+    if (bi->outstanding == 0)
+        batch_send_done(tc, bi);
+}
+
+/* Marks objects for a batched send task. */
+static void batch_send_gc_mark(MVMThreadContext *tc, void *data, MVMGCWorklist *worklist) {
+    BatchSendInfo *bi = (BatchSendInfo *)data;
+    MVM_gc_worklist_add(tc, worklist, &bi->handle);
+    MVM_gc_worklist_add(tc, worklist, &bi->records);
+}
+
+/* Frees the resolved destinations of a batch, minding that runs of records
+ * share them. */
+static void free_batch_dests(struct sockaddr **dests, MVMuint32 count) {
+    MVMuint32 i;
+    for (i = 0; i < count; i++)
+        if (dests[i] && (i == 0 || dests[i] != dests[i - 1]))
+            MVM_free(dests[i]);
+    MVM_free(dests);
+}
+
+/* Frees info for a batched send task. */
+static void batch_send_gc_free(MVMThreadContext *tc, MVMObject *t, void *data) {
+    if (data) {
+        BatchSendInfo *bi = (BatchSendInfo *)data;
+        free_batch_dests(bi->dests, bi->count);
+        MVM_free(bi);
+    }
+}
+
+/* Operations table for async batched send task. */
+static const MVMAsyncTaskOps batch_send_op_table = {
+    batch_send_setup,
+    NULL,
+    NULL,
+    batch_send_gc_mark,
+    batch_send_gc_free
+};
+
 /* Does an asynchronous close (since it must run on the event loop). */
 static void close_perform(MVMThreadContext *tc, uv_loop_t *loop, MVMObject *async_task, void *data) {
-    uv_handle_t *handle = (uv_handle_t *)data;
+    uv_handle_t             *handle      = (uv_handle_t *)data;
+    MVMIOAsyncUDPSocketData *handle_data = (MVMIOAsyncUDPSocketData *)handle->data;
 
     if (uv_is_closing(handle))
         MVM_exception_throw_adhoc(tc, "cannot close a closed socket");
 
+    /* A batched read watches a duplicate of the socket's descriptor, which
+     * would keep it open. */
+    if (handle_data && handle_data->reading && handle_data->reading->batch)
+        batch_read_stop(tc, handle_data->reading);
+
     uv_close(handle, free_on_close_cb);
 }
 
@@ -437,6 +855,7 @@ static MVMint64 close_socket(MVMThreadContext *tc, MVMOSHandle *h) {
     });
     task->body.ops  = &close_op_table;
     task->body.data = data->handle;
+    task->body.event_loop = data->event_loop;
     MVM_io_eventloop_queue_work(tc, (MVMObject *)task);
 
     return 0;
@@ -495,6 +914,7 @@ static void setup_setup(MVMThreadContext *tc, uv_loop_t *loop, MVMObject *async_
     uv_udp_t *udp_handle = MVM_malloc(sizeof(uv_udp_t));
     int r;
     if ((r = uv_udp_init(loop, udp_handle)) >= 0) {
+        udp_handle->data = NULL;
         if (ssi->bind_addr)
             r = uv_udp_bind(udp_handle, ssi->bind_addr, 0);
         if (r >= 0 && (ssi->flags & 1))
@@ -512,6 +932,8 @@ static void setup_setup(MVMThreadContext *tc, uv_loop_t *loop, MVMObject *async_
                 MVMOSHandle          *result = (MVMOSHandle *)MVM_repr_alloc_init(tc, tc->instance->boot_types.BOOTIO);
                 MVMIOAsyncUDPSocketData *data   = MVM_calloc(1, sizeof(MVMIOAsyncUDPSocketData));
                 data->handle                 = udp_handle;
+                data->event_loop             = tc->event_loop;
+                udp_handle->data             = data;
                 result->body.ops             = &op_table;
                 result->body.data            = data;
                 MVM_repr_push_o(tc, arr, (MVMObject *)result);
@@ -602,3 +1024,129 @@ MVMObject * MVM_io_socket_udp_async(MVMThreadContext *tc, MVMObject *queue,
 
     return (MVMObject *)task;
 }
+
+/* Starts reading datagrams from a UDP socket in batches, each delivered as
+ * one queue push. */
+MVMObject * MVM_io_socket_udp_read_batch_async(MVMThreadContext *tc, MVMObject *socket,
+                                               MVMObject *queue, MVMObject *schedulee,
+                                               MVMObject *buf_type, MVMObject *async_type) {
+    MVMAsyncTask *task;
+    ReadInfo     *ri;
+
+    /* Validate REPRs. */
+    if (REPR(queue)->ID != MVM_REPR_ID_ConcBlockingQueue)
+        MVM_exception_throw_adhoc(tc,
+            "asyncudpreadbatch target queue must have ConcBlockingQueue REPR");
+    if (REPR(async_type)->ID != MVM_REPR_ID_MVMAsyncTask)
+        MVM_exception_throw_adhoc(tc,
+            "asyncudpreadbatch result type must have REPR AsyncTask");
+    if (REPR(socket)->ID != MVM_REPR_ID_MVMOSHandle || !IS_CONCRETE(socket)
+            || ((MVMOSHandle *)socket)->body.ops != &op_table)
+        MVM_exception_throw_adhoc(tc, "asyncudpreadbatch requires an asynchronous UDP socket");
+    if (REPR(buf_type)->ID != MVM_REPR_ID_VMArray
+            || (((MVMArrayREPRData *)STABLE(buf_type)->REPR_data)->slot_type != MVM_ARRAY_U8
+             && ((MVMArrayREPRData *)STABLE(buf_type)->REPR_data)->slot_type != MVM_ARRAY_I8))
+        MVM_exception_throw_adhoc(tc, "asyncudpreadbatch buffer type must be an array of uint8 or int8");
+#ifdef _WIN32
+    MVM_exception_throw_adhoc(tc, "asyncudpreadbatch is not supported on this platform");
+#endif
+
+    /* Create async task handle. */
+    MVMROOT4(tc, queue, schedulee, socket, buf_type, {
+        task = (MVMAsyncTask *)MVM_repr_alloc_init(tc, async_type);
+    });
+    MVM_ASSIGN_REF(tc, &(task->common.header), task->body.queue, queue);
+    MVM_ASSIGN_REF(tc, &(task->common.header), task->body.schedulee, schedulee);
+    task->body.ops  = &batch_read_op_table;
+    ri              = MVM_calloc(1, sizeof(ReadInfo));
+    MVM_ASSIGN_REF(tc, &(task->common.header), ri->buf_type, buf_type);
+    MVM_ASSIGN_REF(tc, &(task->common.header), ri->handle, socket);
+    task->body.data = ri;
+    task->body.event_loop = ((MVMIOAsyncUDPSocketData *)((MVMOSHandle *)socket)->body.data)->event_loop;
+
+    /* Hand the task off to the event loop. */
+    MVMROOT(tc, task, {
+        MVM_io_eventloop_queue_work(tc, (MVMObject *)task);
+    });
+
+    return (MVMObject *)task;
+}
+
+/* Sends a batch of datagrams from a UDP socket. The records are a flat array
+ * of buffer, host and port for each datagram. */
+MVMObject * MVM_io_socket_udp_write_batch_async(MVMThreadContext *tc, MVMObject *socket,
+                                                MVMObject *queue, MVMObject *schedulee,
+                                                MVMObject *records, MVMObject *async_type) {
+    MVMAsyncTask     *task;
+    BatchSendInfo    *bi;
+    struct sockaddr **dests;
+    MVMuint64         elems, count, i;
+
+    /* Validate REPRs and records. */
+    if (REPR(queue)->ID != MVM_REPR_ID_ConcBlockingQueue)
+        MVM_exception_throw_adhoc(tc,
+            "asyncudpwritebatch target queue must have ConcBlockingQueue REPR");
+    if (REPR(async_type)->ID != MVM_REPR_ID_MVMAsyncTask)
+        MVM_exception_throw_adhoc(tc,
+            "asyncudpwritebatch result type must have REPR AsyncTask");
+    if (REPR(socket)->ID != MVM_REPR_ID_MVMOSHandle || !IS_CONCRETE(socket)
+            || ((MVMOSHandle *)socket)->body.ops != &op_table)
+        MVM_exception_throw_adhoc(tc, "asyncudpwritebatch requires an asynchronous UDP socket");
+    if (!IS_CONCRETE(records) || REPR(records)->ID != MVM_REPR_ID_VMArray
+            || ((MVMArrayREPRData *)STABLE(records)->REPR_data)->slot_type != MVM_ARRAY_OBJ)
+        MVM_exception_throw_adhoc(tc, "asyncudpwritebatch requires an array of records");
+    elems = MVM_repr_elems(tc, records);
+    if (elems % 3 != 0 || elems / 3 > 0xFFFFFFFF)
+        MVM_exception_throw_adhoc(tc,
+            "asyncudpwritebatch records must be a buffer, host and port per datagram");
+    count = elems / 3;
+    for (i = 0; i < count; i++) {
+        MVMObject *buffer = MVM_repr_at_pos_o(tc, records, i * 3);
+        if (!IS_CONCRETE(buffer) || REPR(buffer)->ID != MVM_REPR_ID_VMArray
+                || (((MVMArrayREPRData *)STABLE(buffer)->REPR_data)->slot_type != MVM_ARRAY_U8
+                 && ((MVMArrayREPRData *)STABLE(buffer)->REPR_data)->slot_type != MVM_ARRAY_I8))
+            MVM_exception_throw_adhoc(tc,
+                "asyncudpwritebatch requires each buffer to be a native array of uint8 or int8");
+    }
+
+    /* Create async task handle. It owns the destinations from the start, so
+     * that those already resolved are freed along with it if resolving one
+     * of the others throws. */
+    MVMROOT5(tc, queue, schedulee, socket, records, async_type, {
+        task = (MVMAsyncTask *)MVM_repr_alloc_init(tc, async_type);
+    });
+    MVM_ASSIGN_REF(tc, &(task->common.header), task->body.queue, queue);
+    MVM_ASSIGN_REF(tc, &(task->common.header), task->body.schedulee, schedulee);
+    task->body.ops  = &batch_send_op_table;
+    bi              = MVM_calloc(1, sizeof(BatchSendInfo));
+    MVM_ASSIGN_REF(tc, &(task->common.header), bi->handle, socket);
+    MVM_ASSIGN_REF(tc, &(task->common.header), bi->records, records);
+    dests           = MVM_calloc(count ? count : 1, sizeof(struct sockaddr *));
+    bi->dests       = dests;
+    bi->count       = (MVMuint32)count;
+    task->body.data = bi;
+    task->body.event_loop = ((MVMIOAsyncUDPSocketData *)((MVMOSHandle *)socket)->body.data)->event_loop;
+
+    /* Resolve the destinations, once per run of records to the same place. */
+    MVMROOT2(tc, task, records, {
+        for (i = 0; i < count; i++) {
+            MVMString *host = MVM_repr_get_str(tc, MVM_repr_at_pos_o(tc, records, i * 3 + 1));
+            MVMint64   port = MVM_repr_get_int(tc, MVM_repr_at_pos_o(tc, records, i * 3 + 2));
+            if (i > 0
+                    && port == MVM_repr_get_int(tc, MVM_repr_at_pos_o(tc, records, i * 3 - 1))
+                    && MVM_string_equal(tc, host,
+                        MVM_repr_get_str(tc, MVM_repr_at_pos_o(tc, records, i * 3 - 2))))
+                dests[i] = dests[i - 1];
+            else
+                dests[i] = MVM_io_resolve_host_name(tc, host, port, MVM_SOCKET_FAMILY_UNSPEC,
+                    MVM_SOCKET_TYPE_DGRAM, MVM_SOCKET_PROTOCOL_ANY, 0);
+        }
+    });
+
+    /* Hand the task off to the event loop. */
+    MVMROOT(tc, task, {
+        MVM_io_eventloop_queue_work(tc, (MVMObject *)task);
+    });
+
+    return (MVMObject *)task;
+}
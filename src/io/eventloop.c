@@ -7,12 +7,17 @@
  * started in the usual way, but never actually ends up in interpreter;
  * instead, it enters a libuv event loop "forever", until program exit.
  *
- * Work is sent to the event loop by
+ * An instance may run several event loops, each on its own thread (see
+ * MVM_EVENT_LOOPS). A task is handed to a loop when it is first queued, in
+ * round-robin order, unless it works on a handle that lives on a particular
+ * loop, in which case it is pinned to that one; after that, its permits and
+ * cancellation go to the same loop.
  */
 
 /* Sets up an async task to be done on the loop. */
 static void setup_work(MVMThreadContext *tc) {
-    MVMConcBlockingQueue *queue = (MVMConcBlockingQueue *)tc->instance->event_loop_todo_queue;
+    MVMIOEventLoop       *el    = tc->event_loop;
+    MVMConcBlockingQueue *queue = (MVMConcBlockingQueue *)el->todo_queue;
     MVMObject *task_obj;
 
     MVMROOT(tc, queue, {
@@ -21,9 +26,10 @@ static void setup_work(MVMThreadContext *tc) {
             MVM_ASSERT_NOT_FROMSPACE(tc, task);
             if (task->body.state == MVM_ASYNC_TASK_STATE_NEW) {
                 MVMROOT(tc, task, {
-                    task->body.ops->setup(tc, tc->instance->event_loop, task_obj, task->body.data);
+                    task->body.ops->setup(tc, el->loop, task_obj, task->body.data);
                     task->body.state = MVM_ASYNC_TASK_STATE_SETUP;
                 });
+                el->tasks_setup++;
             }
         }
     });
@@ -31,7 +37,8 @@ static void setup_work(MVMThreadContext *tc) {
 
 /* Performs an async emit permit grant on the loop. */
 static void permit_work(MVMThreadContext *tc) {
-    MVMConcBlockingQueue *queue = (MVMConcBlockingQueue *)tc->instance->event_loop_permit_queue;
+    MVMIOEventLoop       *el    = tc->event_loop;
+    MVMConcBlockingQueue *queue = (MVMConcBlockingQueue *)el->permit_queue;
     MVMObject *task_arr;
 
     MVMROOT(tc, queue, {
@@ -42,7 +49,7 @@ static void permit_work(MVMThreadContext *tc) {
             if (task->body.ops->permit) {
                 MVMint64 channel = MVM_repr_get_int(tc, MVM_repr_at_pos_o(tc, task_arr, 1));
                 MVMint64 permit = MVM_repr_get_int(tc, MVM_repr_at_pos_o(tc, task_arr, 2));
-                task->body.ops->permit(tc, tc->instance->event_loop, task_obj, task->body.data, channel, permit);
+                task->body.ops->permit(tc, el->loop, task_obj, task->body.data, channel, permit);
             }
         }
     });
@@ -50,7 +57,8 @@ static void permit_work(MVMThreadContext *tc) {
 
 /* Performs an async cancellation on the loop. */
 static void cancel_work(MVMThreadContext *tc) {
-    MVMConcBlockingQueue *queue = (MVMConcBlockingQueue *)tc->instance->event_loop_cancel_queue;
+    MVMIOEventLoop       *el    = tc->event_loop;
+    MVMConcBlockingQueue *queue = (MVMConcBlockingQueue *)el->cancel_queue;
     MVMObject *task_obj;
 
     MVMROOT(tc, queue, {
@@ -60,7 +68,7 @@ static void cancel_work(MVMThreadContext *tc) {
             if (task->body.state == MVM_ASYNC_TASK_STATE_SETUP) {
                 MVMROOT(tc, task, {
                     if (task->body.ops->cancel)
-                        task->body.ops->cancel(tc, tc->instance->event_loop, task_obj, task->body.data);
+                        task->body.ops->cancel(tc, el->loop, task_obj, task->body.data);
                 });
             }
             task->body.state = MVM_ASYNC_TASK_STATE_CANCELLED;
@@ -78,10 +86,23 @@ static void async_handler(uv_async_t *handle) {
     cancel_work(tc);
 }
 
+/* Keep track of the time the loop spends polling for I/O. */
+static void on_poll_start(uv_prepare_t *handle) {
+    MVMIOEventLoop *el  = (MVMIOEventLoop *)handle->data;
+    el->poll_started_at = uv_hrtime();
+}
+static void on_poll_end(uv_check_t *handle) {
+    MVMIOEventLoop *el = (MVMIOEventLoop *)handle->data;
+    if (el->poll_started_at)
+        el->idle_time += uv_hrtime() - el->poll_started_at;
+    el->poll_started_at = 0;
+}
+
 /* Enters the event loop. */
 static void enter_loop(MVMThreadContext *tc, MVMCallsite *callsite, MVMRegister *args) {
-    uv_loop_t    *loop = tc->instance->event_loop;
-    uv_async_t   *async = tc->instance->event_loop_wakeup;
+    MVMIOEventLoop *el    = tc->event_loop;
+    uv_loop_t      *loop  = el->loop;
+    uv_async_t     *async = el->wakeup;
 
 #ifdef MVM_HAS_PTHREAD_SETNAME_NP
     pthread_setname_np(pthread_self(), "async io thread");
@@ -91,17 +112,55 @@ static void enter_loop(MVMThreadContext *tc, MVMCallsite *callsite, MVMRegister
     async->data = tc;
 
     /* Enter event loop */
+    el->running_since = uv_hrtime();
     uv_run(loop, UV_RUN_DEFAULT);
 }
 
-/* Sees if we have an event loop processing thread set up already, and
- * sets it up if not. */
+/* Sets up the state of an event loop. */
+static void init_loop(MVMThreadContext *tc, MVMIOEventLoop *el) {
+    MVMInstance *instance = tc->instance;
+
+    /* The underlying loop structure that will handle all IO events. */
+    el->loop       = MVM_malloc(sizeof(uv_loop_t));
+    if (uv_loop_init(el->loop) < 0)
+        MVM_panic(1, "Unable to initialize event loop");
+    el->loop->data = el;
+
+    /* The async signal handler for waking up the thread */
+    el->wakeup     = MVM_malloc(sizeof(uv_async_t));
+    if (uv_async_init(el->loop, el->wakeup, async_handler) != 0)
+        MVM_panic(1, "Unable to initialize async wake-up handle for event loop");
+
+    /* Handles for measuring utilization; they should not keep the loop
+     * alive by themselves. */
+    uv_prepare_init(el->loop, &el->poll_start);
+    el->poll_start.data = el;
+    uv_prepare_start(&el->poll_start, on_poll_start);
+    uv_unref((uv_handle_t *)&el->poll_start);
+    uv_check_init(el->loop, &el->poll_end);
+    el->poll_end.data = el;
+    uv_check_start(&el->poll_end, on_poll_end);
+    uv_unref((uv_handle_t *)&el->poll_end);
+
+    /* Create various bits of state the async event loop thread needs. */
+    el->todo_queue   = MVM_repr_alloc_init(tc, instance->boot_types.BOOTQueue);
+    el->permit_queue = MVM_repr_alloc_init(tc, instance->boot_types.BOOTQueue);
+    el->cancel_queue = MVM_repr_alloc_init(tc, instance->boot_types.BOOTQueue);
+    el->active       = MVM_repr_alloc_init(tc, instance->boot_types.BOOTArray);
+    el->free_indices = MVM_repr_alloc_init(tc, instance->boot_types.BOOTIntArray);
+}
+
+/* Sees if we have the event loop processing threads set up already, and
+ * sets them up if not. */
 void MVM_io_eventloop_start(MVMThreadContext *tc) {
     MVMInstance *instance = tc->instance;
     MVMObject *loop_runner;
     unsigned int interval_id;
+    MVMuint32 i;
 
-    if (instance->event_loop_thread)
+    /* Only set once every loop has been set up and its thread started, so
+     * seeing it means any of them can be handed work. */
+    if (MVM_load(&instance->event_loops_started))
         return;
 
     /* Grab starting mutex and ensure we didn't lose the race. */
@@ -109,57 +168,68 @@ void MVM_io_eventloop_start(MVMThreadContext *tc) {
     MVM_gc_mark_thread_blocked(tc);
     uv_mutex_lock(&instance->mutex_event_loop);
     MVM_gc_mark_thread_unblocked(tc);
+    if (MVM_load(&instance->event_loops_started)) {
+        uv_mutex_unlock(&instance->mutex_event_loop);
+        return;
+    }
 
-    interval_id = MVM_telemetry_interval_start(tc, "creating the event loop thread");
+    interval_id = MVM_telemetry_interval_start(tc, "creating the event loop threads");
 
     /* We may have lost the race, so we need to setup state carefully */
     /* This may also be present if this is a thread restart */
-    if (!instance->event_loop) {
-        /* The underlying loop structure that will handle all IO events. */
-        instance->event_loop              = MVM_malloc(sizeof(uv_loop_t));
-        if (uv_loop_init(instance->event_loop) < 0)
-            MVM_panic(1, "Unable to initialize event loop");
-
-        /* The async signal handler for waking up the thread */
-        instance->event_loop_wakeup       = MVM_malloc(sizeof(uv_async_t));
-        if (uv_async_init(instance->event_loop, instance->event_loop_wakeup, async_handler) != 0)
-            MVM_panic(1, "Unable to initialize async wake-up handle for event loop");
-
-        /* Create various bits of state the async event loop thread needs. */
-        instance->event_loop_todo_queue   = MVM_repr_alloc_init(tc,
-            instance->boot_types.BOOTQueue);
-        instance->event_loop_permit_queue = MVM_repr_alloc_init(tc,
-            instance->boot_types.BOOTQueue);
-        instance->event_loop_cancel_queue = MVM_repr_alloc_init(tc,
-            instance->boot_types.BOOTQueue);
-        instance->event_loop_active       = MVM_repr_alloc_init(tc,
-            instance->boot_types.BOOTArray);
-        instance->event_loop_free_indices = MVM_repr_alloc_init(tc,
-            instance->boot_types.BOOTIntArray);
+    for (i = 0; i < instance->num_event_loops; i++) {
+        MVMIOEventLoop *el = &(instance->event_loops[i]);
+        if (!el->loop)
+            init_loop(tc, el);
+
+        if (!el->thread) {
+            /* Start the event loop thread, which will call a C function that
+             * sits in the uv loop, never leaving until it is stopped from the
+             * outside */
+            loop_runner = MVM_repr_alloc_init(tc, instance->boot_types.BOOTCCode);
+            ((MVMCFunction *)loop_runner)->body.func = enter_loop;
+
+            el->thread = MVM_thread_new(tc, loop_runner, 1);
+            ((MVMThread *)el->thread)->body.tc->event_loop = el;
+            MVM_thread_run(tc, el->thread);
+        }
     }
 
-    if (!instance->event_loop_thread) {
-        /* Start the event loop thread, which will call a C function that
-         * sits in the uv loop, never leaving until it is stopped from the
-         * outside */
-        loop_runner = MVM_repr_alloc_init(tc, instance->boot_types.BOOTCCode);
-        ((MVMCFunction *)loop_runner)->body.func = enter_loop;
+    MVM_store(&instance->event_loops_started, 1);
 
-        instance->event_loop_thread = MVM_thread_new(tc, loop_runner, 1);
-        MVM_thread_run(tc, instance->event_loop_thread);
-    }
-
-    MVM_telemetry_interval_stop(tc, interval_id, "created the event loop thread");
+    MVM_telemetry_interval_stop(tc, interval_id, "created the event loop threads");
     uv_mutex_unlock(&instance->mutex_event_loop);
 }
 
+/* Picks the event loop to hand the next new piece of work to. */
+MVMIOEventLoop * MVM_io_eventloop_next(MVMThreadContext *tc) {
+    MVMInstance *instance = tc->instance;
+    if (instance->num_event_loops == 1)
+        return &(instance->event_loops[0]);
+    return &(instance->event_loops[
+        (MVMuint32)MVM_incr(&instance->event_loop_next) % instance->num_event_loops]);
+}
+
+/* Gets the event loop an async task runs on, assigning it one if it has not
+ * been given one yet. */
+MVMIOEventLoop * MVM_io_eventloop_for_task(MVMThreadContext *tc, MVMAsyncTask *task) {
+    MVMIOEventLoop *el = task->body.event_loop;
+    if (!el) {
+        el = MVM_io_eventloop_next(tc);
+        if (MVM_casptr(&(task->body.event_loop), NULL, el) != NULL)
+            el = task->body.event_loop;
+    }
+    return el;
+}
 
 /* Adds a work item into the event loop work queue. */
 void MVM_io_eventloop_queue_work(MVMThreadContext *tc, MVMObject *work) {
     MVMROOT(tc, work, {
+        MVMIOEventLoop *el;
         MVM_io_eventloop_start(tc);
-        MVM_repr_push_o(tc, tc->instance->event_loop_todo_queue, work);
-        uv_async_send(tc->instance->event_loop_wakeup);
+        el = MVM_io_eventloop_for_task(tc, (MVMAsyncTask *)work);
+        MVM_repr_push_o(tc, el->todo_queue, work);
+        uv_async_send(el->wakeup);
     });
 }
 
@@ -175,6 +245,7 @@ void MVM_io_eventloop_permit(MVMThreadContext *tc, MVMObject *task_obj,
             MVMObject *permits_box = NULL;
             MVMObject *arr = NULL;
             MVMROOT3(tc, channel_box, permits_box, arr, {
+                MVMIOEventLoop *el;
                 channel_box = MVM_repr_box_int(tc, tc->instance->boot_types.BOOTInt, channel);
                 permits_box = MVM_repr_box_int(tc, tc->instance->boot_types.BOOTInt, permits);
                 arr = MVM_repr_alloc_init(tc, tc->instance->boot_types.BOOTArray);
@@ -182,8 +253,9 @@ void MVM_io_eventloop_permit(MVMThreadContext *tc, MVMObject *task_obj,
                 MVM_repr_push_o(tc, arr, channel_box);
                 MVM_repr_push_o(tc, arr, permits_box);
                 MVM_io_eventloop_start(tc);
-                MVM_repr_push_o(tc, tc->instance->event_loop_permit_queue, arr);
-                uv_async_send(tc->instance->event_loop_wakeup);
+                el = MVM_io_eventloop_for_task(tc, (MVMAsyncTask *)task_obj);
+                MVM_repr_push_o(tc, el->permit_queue, arr);
+                uv_async_send(el->wakeup);
             });
         });
     }
@@ -204,9 +276,11 @@ void MVM_io_eventloop_cancel_work(MVMThreadContext *tc, MVMObject *task_obj,
                 notify_schedulee);
         }
         MVMROOT(tc, task_obj, {
+            MVMIOEventLoop *el;
             MVM_io_eventloop_start(tc);
-            MVM_repr_push_o(tc, tc->instance->event_loop_cancel_queue, task_obj);
-            uv_async_send(tc->instance->event_loop_wakeup);
+            el = MVM_io_eventloop_for_task(tc, (MVMAsyncTask *)task_obj);
+            MVM_repr_push_o(tc, el->cancel_queue, task_obj);
+            uv_async_send(el->wakeup);
         });
     }
     else {
@@ -222,20 +296,89 @@ void MVM_io_eventloop_send_cancellation_notification(MVMThreadContext *tc, MVMAs
         MVM_repr_push_o(tc, notify_queue, notify_schedulee);
 }
 
-/* Adds a work item to the active async task set. */
+/* Gets utilization figures for the event loops: an array with an integer
+ * array per loop, holding the number of tasks set up on it, and the time
+ * in nanoseconds it has spent busy and idle (waiting for I/O) since it
+ * started running. */
+MVMObject * MVM_io_eventloop_stats(MVMThreadContext *tc) {
+    MVMInstance *instance = tc->instance;
+    MVMObject   *result   = MVM_repr_alloc_init(tc, instance->boot_types.BOOTArray);
+    MVMuint32    i;
+    MVMROOT(tc, result, {
+        for (i = 0; i < instance->num_event_loops; i++) {
+            MVMIOEventLoop *el      = &(instance->event_loops[i]);
+            MVMuint64       since   = el->running_since;
+            MVMuint64       idle    = el->idle_time;
+            MVMuint64       polling = el->poll_started_at;
+            MVMuint64       now     = uv_hrtime();
+            MVMuint64       running = since ? now - since : 0;
+            MVMObject      *stats   = MVM_repr_alloc_init(tc, instance->boot_types.BOOTIntArray);
+            /* Count a poll that is in progress as idle time. */
+            if (polling && polling < now)
+                idle += now - polling;
+            if (idle > running)
+                idle = running;
+            MVM_repr_push_i(tc, stats, (MVMint64)el->tasks_setup);
+            MVM_repr_push_i(tc, stats, (MVMint64)(running - idle));
+            MVM_repr_push_i(tc, stats, (MVMint64)idle);
+            MVM_repr_push_o(tc, result, stats);
+        }
+    });
+    return result;
+}
+
+/* Gets the size class of receive buffers that can hold the wanted size, or
+ * the largest class if none can. */
+static MVMuint32 recv_buffer_class(size_t wanted) {
+    MVMuint32 cls  = 0;
+    size_t    size = MVM_IO_RECV_BUFFER_MIN_SIZE;
+    while (size < wanted && cls < MVM_IO_RECV_BUFFER_CLASSES - 1) {
+        size <<= 2;
+        cls++;
+    }
+    return cls;
+}
+
+/* Gets a receive buffer of (ideally) the wanted size from the event loop's
+ * pool, allocating one if the pool is empty. The size of the buffer is put
+ * into size. Must be called on the event loop thread. */
+char * MVM_io_eventloop_alloc_recv_buffer(MVMIOEventLoop *el, size_t wanted, size_t *size) {
+    MVMuint32 cls = recv_buffer_class(wanted);
+    *size = (size_t)MVM_IO_RECV_BUFFER_MIN_SIZE << (2 * cls);
+    if (el->num_recv_buffers[cls])
+        return el->recv_buffers[cls][--el->num_recv_buffers[cls]];
+    return MVM_malloc(*size);
+}
+
+/* Returns a receive buffer to the event loop's pool, or frees it if the pool
+ * is full or it is not of one of the pool's sizes. Must be called on the
+ * event loop thread. */
+void MVM_io_eventloop_free_recv_buffer(MVMIOEventLoop *el, char *buffer, size_t size) {
+    MVMuint32 cls = recv_buffer_class(size);
+    if (buffer && size == (size_t)MVM_IO_RECV_BUFFER_MIN_SIZE << (2 * cls)
+            && el->num_recv_buffers[cls] < MVM_IO_RECV_BUFFER_POOL_SIZE)
+        el->recv_buffers[cls][el->num_recv_buffers[cls]++] = buffer;
+    else
+        MVM_free(buffer);
+}
+
+/* Adds a work item to the active async task set of the event loop that the
+ * current thread runs. */
 int MVM_io_eventloop_add_active_work(MVMThreadContext *tc, MVMObject *async_task) {
-    MVMuint64 work_idx = MVM_repr_elems(tc, tc->instance->event_loop_free_indices) > 0
-        ? (MVMuint64)MVM_repr_pop_i(tc, tc->instance->event_loop_free_indices)
-        : MVM_repr_elems(tc, tc->instance->event_loop_active);
+    MVMIOEventLoop *el = tc->event_loop;
+    MVMuint64 work_idx = MVM_repr_elems(tc, el->free_indices) > 0
+        ? (MVMuint64)MVM_repr_pop_i(tc, el->free_indices)
+        : MVM_repr_elems(tc, el->active);
     MVM_ASSERT_NOT_FROMSPACE(tc, async_task);
-    MVM_repr_bind_pos_o(tc, tc->instance->event_loop_active, work_idx, async_task);
+    MVM_repr_bind_pos_o(tc, el->active, work_idx, async_task);
     return work_idx;
 }
 
 /* Gets an active work item from the active work eventloop. */
 MVMAsyncTask * MVM_io_eventloop_get_active_work(MVMThreadContext *tc, int work_idx) {
-    if (work_idx >= 0 && work_idx < (int)MVM_repr_elems(tc, tc->instance->event_loop_active)) {
-        MVMObject *task_obj = MVM_repr_at_pos_o(tc, tc->instance->event_loop_active, work_idx);
+    MVMIOEventLoop *el = tc->event_loop;
+    if (work_idx >= 0 && work_idx < (int)MVM_repr_elems(tc, el->active)) {
+        MVMObject *task_obj = MVM_repr_at_pos_o(tc, el->active, work_idx);
         if (REPR(task_obj)->ID != MVM_REPR_ID_MVMAsyncTask)
             MVM_panic(1, "non-AsyncTask fetched from eventloop active work list");
         MVM_ASSERT_NOT_FROMSPACE(tc, task_obj);
@@ -250,11 +393,12 @@ MVMAsyncTask * MVM_io_eventloop_get_active_work(MVMThreadContext *tc, int work_i
  * memory associated with it to be collected. Replaces the work index with -1
  * so that any future use of the task will be a failed lookup. */
 void MVM_io_eventloop_remove_active_work(MVMThreadContext *tc, int *work_idx_to_clear) {
+    MVMIOEventLoop *el = tc->event_loop;
     int work_idx = *work_idx_to_clear;
-    if (work_idx >= 0 && work_idx < (int)MVM_repr_elems(tc, tc->instance->event_loop_active)) {
+    if (work_idx >= 0 && work_idx < (int)MVM_repr_elems(tc, el->active)) {
         *work_idx_to_clear = -1;
-        MVM_repr_bind_pos_o(tc, tc->instance->event_loop_active, work_idx, tc->instance->VMNull);
-        MVM_repr_push_i(tc, tc->instance->event_loop_free_indices, work_idx);
+        MVM_repr_bind_pos_o(tc, el->active, work_idx, tc->instance->VMNull);
+        MVM_repr_push_i(tc, el->free_indices, work_idx);
     }
     else {
         MVM_panic(1, "cannot remove invalid eventloop work item index %d", work_idx);
@@ -266,42 +410,58 @@ void MVM_io_eventloop_remove_active_work(MVMThreadContext *tc, int *work_idx_to_
 /* Send the stop signal - no synchronization required */
 void MVM_io_eventloop_stop(MVMThreadContext *tc) {
     MVMInstance *instance = tc->instance;
-    if (!instance->event_loop_thread)
-        return;
-    /* Stop the loop */
-    uv_stop(instance->event_loop);
-    uv_async_send(instance->event_loop_wakeup);
+    MVMuint32 i;
+    for (i = 0; i < instance->num_event_loops; i++) {
+        MVMIOEventLoop *el = &(instance->event_loops[i]);
+        if (!el->thread)
+            continue;
+        /* Stop the loop */
+        uv_stop(el->loop);
+        uv_async_send(el->wakeup);
+    }
 }
 
 /* Wait for exit (again, no synchronizaiton required) */
 void MVM_io_eventloop_join(MVMThreadContext *tc) {
     MVMInstance *instance = tc->instance;
-    if (!instance->event_loop_thread)
-        return;
-    MVM_thread_join(tc, instance->event_loop_thread);
+    MVMuint32 i;
+    for (i = 0; i < instance->num_event_loops; i++) {
+        MVMIOEventLoop *el = &(instance->event_loops[i]);
+        if (el->thread)
+            MVM_thread_join(tc, el->thread);
+    }
 }
 
 /* Clean up used resources. Synchronization required - other threads might modify them as well */
 void MVM_io_eventloop_destroy(MVMThreadContext *tc) {
     MVMInstance *instance = tc->instance;
+    MVMuint32 i;
     MVM_gc_mark_thread_blocked(tc);
     uv_mutex_lock(&instance->mutex_event_loop);
     MVM_gc_mark_thread_unblocked(tc);
 
-    if (instance->event_loop_thread) {
-        MVM_io_eventloop_stop(tc);
-        MVM_io_eventloop_join(tc);
-        instance->event_loop_thread = NULL;
-    }
-
-    if (instance->event_loop) {
-        uv_close((uv_handle_t*)instance->event_loop_wakeup, NULL);
-
-        /* Not sure we can always do this */
-        uv_loop_close(instance->event_loop);
-       
-        MVM_free_null(instance->event_loop_wakeup);
-        MVM_free_null(instance->event_loop);
+    MVM_io_eventloop_stop(tc);
+    MVM_io_eventloop_join(tc);
+    MVM_store(&instance->event_loops_started, 0);
+
+    for (i = 0; i < instance->num_event_loops; i++) {
+        MVMIOEventLoop *el = &(instance->event_loops[i]);
+        MVMuint32 cls;
+        el->thread = NULL;
+        for (cls = 0; cls < MVM_IO_RECV_BUFFER_CLASSES; cls++)
+            while (el->num_recv_buffers[cls])
+                MVM_free(el->recv_buffers[cls][--el->num_recv_buffers[cls]]);
+        if (el->loop) {
+            uv_close((uv_handle_t*)el->wakeup, NULL);
+            uv_close((uv_handle_t*)&el->poll_start, NULL);
+            uv_close((uv_handle_t*)&el->poll_end, NULL);
+
+            /* Not sure we can always do this */
+            uv_loop_close(el->loop);
+
+            MVM_free_null(el->wakeup);
+            MVM_free_null(el->loop);
+        }
     }
 
     uv_mutex_unlock(&instance->mutex_event_loop);
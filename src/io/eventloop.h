@@ -18,6 +18,55 @@ struct MVMAsyncTaskOps {
     void (*gc_free) (MVMThreadContext *tc, MVMObject *t, void *data);
 };
 
+/* Maximum number of event loops an instance may run. */
+#define MVM_IO_EVENT_LOOPS_MAX 64
+
+/* Receive buffers are recycled through a pool per event loop, in a few size
+ * classes (4KB, 16KB and 64KB), each holding up to a number of buffers. */
+#define MVM_IO_RECV_BUFFER_CLASSES    3
+#define MVM_IO_RECV_BUFFER_MIN_SIZE   4096
+#define MVM_IO_RECV_BUFFER_POOL_SIZE  16
+
+/* An event loop, along with the thread that runs it and the state needed to
+ * hand it work. */
+struct MVMIOEventLoop {
+    /* The thread running the loop. */
+    MVMObject *thread;
+
+    /* The underlying libuv loop, and the async handle used to wake it up. */
+    uv_loop_t  *loop;
+    uv_async_t *wakeup;
+
+    /* Concurrent queues of tasks to set up, emit permits to grant and tasks
+     * to cancel, and an array of active tasks (and free slots in it), for
+     * the purpose of keeping them GC marked. */
+    MVMObject *todo_queue;
+    MVMObject *permit_queue;
+    MVMObject *cancel_queue;
+    MVMObject *active;
+    MVMObject *free_indices;
+
+    /* Handles run just before and just after the loop polls for I/O, so we
+     * can tell how much time it spends waiting. */
+    uv_prepare_t poll_start;
+    uv_check_t   poll_end;
+
+    /* Utilization figures: when the loop started running, when the current
+     * poll started, the total time spent polling, and the number of tasks
+     * set up on the loop. */
+    MVMuint64 running_since;
+    MVMuint64 poll_started_at;
+    MVMuint64 idle_time;
+    MVMuint64 tasks_setup;
+
+    /* Pools of receive buffers, per size class. */
+    char      *recv_buffers[MVM_IO_RECV_BUFFER_CLASSES][MVM_IO_RECV_BUFFER_POOL_SIZE];
+    MVMuint32  num_recv_buffers[MVM_IO_RECV_BUFFER_CLASSES];
+
+    /* Index of the loop in the instance's event loops. */
+    MVMuint32 index;
+};
+
 void MVM_io_eventloop_queue_work(MVMThreadContext *tc, MVMObject *work);
 void MVM_io_eventloop_permit(MVMThreadContext *tc, MVMObject *task_obj,
     MVMint64 channel, MVMint64 permits);
@@ -25,6 +74,13 @@ void MVM_io_eventloop_cancel_work(MVMThreadContext *tc, MVMObject *task_obj,
     MVMObject *notify_queue, MVMObject *notify_schedulee);
 void MVM_io_eventloop_send_cancellation_notification(MVMThreadContext *tc, MVMAsyncTask *task_obj);
 
+MVMIOEventLoop * MVM_io_eventloop_next(MVMThreadContext *tc);
+MVMIOEventLoop * MVM_io_eventloop_for_task(MVMThreadContext *tc, MVMAsyncTask *task);
+MVMObject * MVM_io_eventloop_stats(MVMThreadContext *tc);
+
+char * MVM_io_eventloop_alloc_recv_buffer(MVMIOEventLoop *el, size_t wanted, size_t *size);
+void MVM_io_eventloop_free_recv_buffer(MVMIOEventLoop *el, char *buffer, size_t size);
+
 int MVM_io_eventloop_add_active_work(MVMThreadContext *tc, MVMObject *async_task);
 MVMAsyncTask * MVM_io_eventloop_get_active_work(MVMThreadContext *tc, int work_idx);
 void MVM_io_eventloop_remove_active_work(MVMThreadContext *tc, int *work_idx_to_clear);
@@ -33,3 +89,8 @@ void MVM_io_eventloop_start(MVMThreadContext *tc);
 void MVM_io_eventloop_stop(MVMThreadContext *tc);
 void MVM_io_eventloop_join(MVMThreadContext *tc);
 void MVM_io_eventloop_destroy(MVMThreadContext *tc);
+
+/* Gets the event loop that a libuv loop belongs to. */
+MVM_STATIC_INLINE MVMIOEventLoop * MVM_io_eventloop_of(uv_loop_t *loop) {
+    return (MVMIOEventLoop *)loop->data;
+}
@@ -1,4 +1,5 @@
 #include "moar.h"
+#include "platform/mmap.h"
 
 #ifndef _WIN32
 #include <sys/types.h>
@@ -429,3 +430,75 @@ MVMString * MVM_file_readlink(MVMThreadContext *tc, MVMString *path) {
 
     return result;
 }
+
+/* Maps length bytes of a file, starting at offset, into memory and returns
+ * them as a buffer of the given type (a VMArray of uint8 or int8), without
+ * copying them. A negative length maps up to the end of the file. The mapping
+ * is copy-on-write, so writing to the buffer never touches the file; it is
+ * unmapped when the buffer is collected (or copied to the heap should the
+ * buffer be grown). */
+MVMObject * MVM_file_map(MVMThreadContext *tc, MVMString *filename, MVMint64 offset, MVMint64 length, MVMObject *buf_type) {
+    MVMObject *result;
+    MVMuint64  size, delta;
+    void      *block = NULL;
+    uv_file    fd;
+    uv_fs_t    req;
+    char      *filename_s;
+
+    if (REPR(buf_type)->ID != MVM_REPR_ID_VMArray)
+        MVM_exception_throw_adhoc(tc, "mapfile requires a native array type");
+    switch (((MVMArrayREPRData *)STABLE(buf_type)->REPR_data)->slot_type) {
+        case MVM_ARRAY_U8:
+        case MVM_ARRAY_I8:
+            break;
+        default:
+            MVM_exception_throw_adhoc(tc, "mapfile requires a buffer of uint8 or int8 elements");
+    }
+    if (offset < 0)
+        MVM_exception_throw_adhoc(tc, "Cannot map file from negative offset %"PRId64, offset);
+
+    filename_s = MVM_string_utf8_c8_encode_C_string(tc, filename);
+    if ((fd = uv_fs_open(NULL, &req, filename_s, O_RDONLY, 0, NULL)) < 0) {
+        MVM_free(filename_s);
+        MVM_exception_throw_adhoc(tc, "Failed to open file to map: %s", uv_strerror(req.result));
+    }
+    MVM_free(filename_s);
+
+    if (uv_fs_fstat(NULL, &req, fd, NULL) < 0) {
+        int r = req.result;
+        uv_fs_close(NULL, &req, fd, NULL);
+        MVM_exception_throw_adhoc(tc, "Failed to stat file to map: %s", uv_strerror(r));
+    }
+    size = req.statbuf.st_size;
+    if ((MVMuint64)offset > size) {
+        uv_fs_close(NULL, &req, fd, NULL);
+        MVM_exception_throw_adhoc(tc, "Cannot map file from offset %"PRId64" beyond its end", offset);
+    }
+    if (length < 0 || (MVMuint64)length > size - offset)
+        length = size - offset;
+
+    /* The mapping has to start on a granularity boundary; the buffer starts
+     * delta bytes into it. */
+    delta = (MVMuint64)offset % MVM_platform_map_granularity();
+    if (delta + length > SIZE_MAX) {
+        uv_fs_close(NULL, &req, fd, NULL);
+        MVM_exception_throw_adhoc(tc, "Cannot map %"PRId64" bytes of a file on this platform", length);
+    }
+    if (length > 0 && (block = MVM_platform_map_file_private(fd, offset - delta,
+            (size_t)(delta + length))) == NULL) {
+        uv_fs_close(NULL, &req, fd, NULL);
+        MVM_exception_throw_adhoc(tc, "Failed to map file into memory");
+    }
+    uv_fs_close(NULL, &req, fd, NULL);
+
+    result = MVM_repr_alloc_init(tc, buf_type);
+    if (block) {
+        MVMArrayBody *body = &((MVMArray *)result)->body;
+        body->slots.u8 = (MVMuint8 *)block;
+        body->start    = delta;
+        body->ssize    = delta + length;
+        body->elems    = length;
+        result->header.flags1 |= MVM_CF_MAPPED_MEMORY;
+    }
+    return result;
+}
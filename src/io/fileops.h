@@ -39,3 +39,4 @@ MVMString * MVM_file_in_libpath(MVMThreadContext *tc, MVMString *orig);
 void MVM_file_link(MVMThreadContext *tc, MVMString *oldpath, MVMString *newpath);
 void MVM_file_symlink(MVMThreadContext *tc, MVMString *oldpath, MVMString *newpath);
 MVMString * MVM_file_readlink(MVMThreadContext *tc, MVMString *path);
+MVMObject * MVM_file_map(MVMThreadContext *tc, MVMString *filename, MVMint64 offset, MVMint64 length, MVMObject *buf_type);
@@ -1,4 +1,5 @@
 #include "moar.h"
+#include "platform/mmap.h"
 
 /* Delegatory functions that assert we have a capable handle, then delegate
  * through the IO table to the correct operation. */
@@ -103,6 +104,7 @@ MVMint64 MVM_io_tell(MVMThreadContext *tc, MVMObject *oshandle) {
 
 void MVM_io_read_bytes(MVMThreadContext *tc, MVMObject *oshandle, MVMObject *result, MVMint64 length) {
     MVMOSHandle *handle = verify_is_handle(tc, oshandle, "read bytes");
+    MVMArrayBody *body;
     MVMuint64 bytes_read;
     char *buf;
 
@@ -117,20 +119,44 @@ void MVM_io_read_bytes(MVMThreadContext *tc, MVMObject *oshandle, MVMObject *res
         MVM_exception_throw_adhoc(tc, "Out of range: attempted to read %"PRId64" bytes from filehandle", length);
 
     if (handle->body.ops->sync_readable) {
+        const MVMIOSyncReadable *readable = handle->body.ops->sync_readable;
+
+        /* If the handle can read into a buffer we supply and the array
+         * already has enough storage, read straight into that, so a buffer
+         * that is passed in again and again is not reallocated each time. */
+        body = &((MVMArray *)result)->body;
+        buf  = readable->read_bytes_into && body->ssize >= (MVMuint64)length
+                && !(result->header.flags1 & MVM_CF_MAPPED_MEMORY)
+            ? (char *)body->slots.i8
+            : NULL;
+
         MVMROOT2(tc, handle, result, {
             uv_mutex_t *mutex = acquire_mutex(tc, handle);
-            bytes_read = handle->body.ops->sync_readable->read_bytes(tc, handle, &buf, length);
+            bytes_read = buf
+                ? readable->read_bytes_into(tc, handle, buf, length)
+                : readable->read_bytes(tc, handle, &buf, length);
             release_mutex(tc, mutex);
         });
     }
     else
         MVM_exception_throw_adhoc(tc, "Cannot read characters from this kind of handle");
 
-    /* Stash the data in the VMArray. */
-    ((MVMArray *)result)->body.slots.i8 = (MVMint8 *)buf;
-    ((MVMArray *)result)->body.start    = 0;
-    ((MVMArray *)result)->body.ssize    = bytes_read;
-    ((MVMArray *)result)->body.elems    = bytes_read;
+    /* Stash the data in the VMArray, freeing any storage it had if we did
+     * not read into that. */
+    body = &((MVMArray *)result)->body;
+    if (buf != (char *)body->slots.i8) {
+        if (result->header.flags1 & MVM_CF_MAPPED_MEMORY) {
+            MVM_platform_unmap_file(body->slots.any, NULL, (size_t)body->ssize);
+            result->header.flags1 &= ~MVM_CF_MAPPED_MEMORY;
+        }
+        else {
+            MVM_free(body->slots.any);
+        }
+        body->slots.i8 = (MVMint8 *)buf;
+        body->ssize    = bytes_read;
+    }
+    body->start = 0;
+    body->elems = bytes_read;
 }
 
 void MVM_io_write_bytes(MVMThreadContext *tc, MVMObject *oshandle, MVMObject *buffer) {
@@ -165,6 +191,116 @@ void MVM_io_write_bytes(MVMThreadContext *tc, MVMObject *oshandle, MVMObject *bu
         MVM_exception_throw_adhoc(tc, "Cannot write bytes to this kind of handle");
 }
 
+/* Checks whether something can be a piece of a vectored write: a native
+ * array of uint8 or int8, or something holding a string. */
+static int is_vec_piece(MVMThreadContext *tc, MVMObject *piece) {
+    if (!piece || !IS_CONCRETE(piece))
+        return 0;
+    if (REPR(piece)->ID == MVM_REPR_ID_VMArray) {
+        MVMuint8 slot_type = ((MVMArrayREPRData *)STABLE(piece)->REPR_data)->slot_type;
+        return slot_type == MVM_ARRAY_U8 || slot_type == MVM_ARRAY_I8;
+    }
+    return REPR(piece)->ID == MVM_REPR_ID_MVMString
+        || (REPR(piece)->get_storage_spec(tc, STABLE(piece))->can_box & MVM_STORAGE_SPEC_CAN_BOX_STR);
+}
+
+/* Turns an array of buffers and strings (or a native array of strings) into
+ * a list of pieces for a vectored write, encoding the strings as UTF-8. The
+ * buffers are pointed to in place, so must not change until the write is
+ * done. Produces no GC allocations. */
+MVMIOVecPiece * MVM_io_vec_pieces(MVMThreadContext *tc, MVMObject *pieces, MVMuint32 *count,
+                                  MVMuint64 *total, const char *op_name) {
+    MVMIOVecPiece *result;
+    MVMuint64      elems, i;
+    MVMuint8       slot_type;
+
+    if (!IS_CONCRETE(pieces) || REPR(pieces)->ID != MVM_REPR_ID_VMArray)
+        MVM_exception_throw_adhoc(tc, "%s requires an array of buffers and strings", op_name);
+    slot_type = ((MVMArrayREPRData *)STABLE(pieces)->REPR_data)->slot_type;
+    if (slot_type != MVM_ARRAY_OBJ && slot_type != MVM_ARRAY_STR)
+        MVM_exception_throw_adhoc(tc, "%s requires an array of buffers and strings", op_name);
+    elems = MVM_repr_elems(tc, pieces);
+    if (elems > 0xFFFFFFFF)
+        MVM_exception_throw_adhoc(tc, "%s can write at most 4294967295 pieces", op_name);
+
+    /* Check everything first, so a bad piece fails before any work. */
+    if (slot_type == MVM_ARRAY_OBJ)
+        for (i = 0; i < elems; i++)
+            if (!is_vec_piece(tc, MVM_repr_at_pos_o(tc, pieces, i)))
+                MVM_exception_throw_adhoc(tc,
+                    "%s requires each piece to be a native array of uint8 or int8, or a string",
+                    op_name);
+
+    /* Encoding a string can still throw, so until all of them are done the
+     * list is freed on exception throw; pieces not done yet own nothing. */
+    result = MVM_calloc(elems ? elems : 1, sizeof(MVMIOVecPiece));
+    MVM_tc_set_ex_free_vec_pieces(tc, result, (MVMuint32)elems);
+    *total = 0;
+    for (i = 0; i < elems; i++) {
+        MVMIOVecPiece *piece = &result[i];
+        MVMObject     *obj   = slot_type == MVM_ARRAY_OBJ ? MVM_repr_at_pos_o(tc, pieces, i) : NULL;
+        if (obj && REPR(obj)->ID == MVM_REPR_ID_VMArray) {
+            MVMArrayBody *body = &((MVMArray *)obj)->body;
+            piece->data   = (char *)(body->slots.i8 + body->start);
+            piece->length = body->elems;
+        }
+        else {
+            MVMString *str = !obj
+                ? MVM_repr_at_pos_s(tc, pieces, i)
+                : REPR(obj)->ID == MVM_REPR_ID_MVMString
+                ? (MVMString *)obj
+                : MVM_repr_get_str(tc, obj);
+            if (str) {
+                piece->data   = MVM_string_utf8_encode(tc, str, &(piece->length), 0);
+                piece->owned  = 1;
+            }
+        }
+        *total += piece->length;
+    }
+    MVM_tc_clear_ex_free_vec_pieces(tc);
+
+    *count = (MVMuint32)elems;
+    return result;
+}
+
+/* Frees a list of pieces for a vectored write, and any strings encoded for
+ * it. */
+void MVM_io_vec_pieces_free(MVMThreadContext *tc, MVMIOVecPiece *pieces, MVMuint32 count) {
+    MVMuint32 i;
+    for (i = 0; i < count; i++)
+        if (pieces[i].owned)
+            MVM_free(pieces[i].data);
+    MVM_free(pieces);
+}
+
+/* Writes an array of buffers and strings to a handle in one go, with a
+ * single vectored write where the handle supports that. */
+void MVM_io_write_bytes_v(MVMThreadContext *tc, MVMObject *oshandle, MVMObject *pieces) {
+    MVMOSHandle   *handle = verify_is_handle(tc, oshandle, "write buffers");
+    MVMIOVecPiece *vec;
+    MVMuint32      count, i;
+    MVMuint64      total;
+
+    if (!handle->body.ops->sync_writable)
+        MVM_exception_throw_adhoc(tc, "Cannot write bytes to this kind of handle");
+    vec = MVM_io_vec_pieces(tc, pieces, &count, &total, "write_fhbv");
+
+    /* Building the pieces did no GC allocation, so handle is still valid.
+     * If the write throws, the pieces are freed along with the mutex. */
+    MVM_tc_set_ex_free_vec_pieces(tc, vec, count);
+    MVMROOT(tc, handle, {
+        const MVMIOSyncWritable *writable = handle->body.ops->sync_writable;
+        uv_mutex_t *mutex = acquire_mutex(tc, handle);
+        if (writable->write_bytes_v)
+            writable->write_bytes_v(tc, handle, vec, count);
+        else
+            for (i = 0; i < count; i++)
+                writable->write_bytes(tc, handle, vec[i].data, vec[i].length);
+        release_mutex(tc, mutex);
+    });
+    MVM_tc_free_ex_free_vec_pieces(tc);
+}
+
 void MVM_io_write_bytes_c(MVMThreadContext *tc, MVMObject *oshandle, char *output,
                           MVMuint64 output_size) {
     MVMOSHandle *handle = verify_is_handle(tc, oshandle, "write bytes");
@@ -215,6 +351,25 @@ MVMObject * MVM_io_write_bytes_async(MVMThreadContext *tc, MVMObject *oshandle,
         MVM_exception_throw_adhoc(tc, "Cannot write bytes asynchronously to this kind of handle");
 }
 
+MVMObject * MVM_io_write_bytes_v_async(MVMThreadContext *tc, MVMObject *oshandle, MVMObject *queue,
+                                       MVMObject *schedulee, MVMObject *pieces, MVMObject *async_type) {
+    MVMOSHandle *handle = verify_is_handle(tc, oshandle, "write buffers asynchronously");
+    if (pieces == NULL)
+        MVM_exception_throw_adhoc(tc, "Failed to write to filehandle: NULL pieces given");
+    if (handle->body.ops->async_writable && handle->body.ops->async_writable->write_bytes_v) {
+        MVMObject *result;
+        MVMROOT5(tc, queue, schedulee, pieces, async_type, handle, {
+            uv_mutex_t *mutex = acquire_mutex(tc, handle);
+            result = (MVMObject *)handle->body.ops->async_writable->write_bytes_v(tc,
+                handle, queue, schedulee, pieces, async_type);
+            release_mutex(tc, mutex);
+        });
+        return result;
+    }
+    else
+        MVM_exception_throw_adhoc(tc, "Cannot write buffers asynchronously to this kind of handle");
+}
+
 MVMObject * MVM_io_write_bytes_to_async(MVMThreadContext *tc, MVMObject *oshandle, MVMObject *queue,
                                         MVMObject *schedulee, MVMObject *buffer, MVMObject *async_type,
                                         MVMString *host, MVMint64 port) {
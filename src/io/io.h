@@ -31,6 +31,10 @@ struct MVMIOClosable {
 struct MVMIOSyncReadable {
     MVMint64 (*read_bytes) (MVMThreadContext *tc, MVMOSHandle *h, char **buf, MVMuint64 bytes);
     MVMint64 (*eof) (MVMThreadContext *tc, MVMOSHandle *h);
+
+    /* Optionally, reading into a buffer of at least the given size that the
+     * caller supplies. */
+    MVMint64 (*read_bytes_into) (MVMThreadContext *tc, MVMOSHandle *h, char *buf, MVMuint64 bytes);
 };
 
 /* I/O operations on handles that can do synchronous writing. */
@@ -38,6 +42,18 @@ struct MVMIOSyncWritable {
     MVMint64 (*write_bytes) (MVMThreadContext *tc, MVMOSHandle *h, char *buf, MVMuint64 bytes);
     void (*flush) (MVMThreadContext *tc, MVMOSHandle *h, MVMint32 sync);
     void (*truncate) (MVMThreadContext *tc, MVMOSHandle *h, MVMint64 bytes);
+
+    /* Optionally, writing a number of pieces in one go; otherwise, they are
+     * written one at a time with write_bytes. */
+    MVMint64 (*write_bytes_v) (MVMThreadContext *tc, MVMOSHandle *h, MVMIOVecPiece *pieces, MVMuint32 count);
+};
+
+/* A piece of a vectored write. Buffers are pointed to where they are;
+ * strings are encoded as UTF-8 into memory the piece owns. */
+struct MVMIOVecPiece {
+    char      *data;
+    MVMuint64  length;
+    MVMuint8   owned;
 };
 
 /* I/O operations on handles that can do asynchronous reading. */
@@ -50,6 +66,10 @@ struct MVMIOAsyncReadable {
 struct MVMIOAsyncWritable {
     MVMAsyncTask * (*write_bytes) (MVMThreadContext *tc, MVMOSHandle *h, MVMObject *queue,
         MVMObject *schedulee, MVMObject *buffer, MVMObject *async_type);
+
+    /* Optionally, writing an array of buffers and strings in one go. */
+    MVMAsyncTask * (*write_bytes_v) (MVMThreadContext *tc, MVMOSHandle *h, MVMObject *queue,
+        MVMObject *schedulee, MVMObject *pieces, MVMObject *async_type);
 };
 
 /* I/O operations on handles that can do asynchronous writing to a given
@@ -94,10 +114,16 @@ void MVM_io_read_bytes(MVMThreadContext *tc, MVMObject *oshandle, MVMObject *res
 void MVM_io_write_bytes(MVMThreadContext *tc, MVMObject *oshandle, MVMObject *buffer);
 void MVM_io_write_bytes_c(MVMThreadContext *tc, MVMObject *oshandle, char *output,
     MVMuint64 output_size);
+MVMIOVecPiece * MVM_io_vec_pieces(MVMThreadContext *tc, MVMObject *pieces, MVMuint32 *count,
+    MVMuint64 *total, const char *op_name);
+void MVM_io_vec_pieces_free(MVMThreadContext *tc, MVMIOVecPiece *pieces, MVMuint32 count);
+void MVM_io_write_bytes_v(MVMThreadContext *tc, MVMObject *oshandle, MVMObject *pieces);
 MVMObject * MVM_io_read_bytes_async(MVMThreadContext *tc, MVMObject *oshandle, MVMObject *queue,
     MVMObject *schedulee, MVMObject *buf_type, MVMObject *async_type);
 MVMObject * MVM_io_write_bytes_async(MVMThreadContext *tc, MVMObject *oshandle, MVMObject *queue,
         MVMObject *schedulee, MVMObject *buffer, MVMObject *async_type);
+MVMObject * MVM_io_write_bytes_v_async(MVMThreadContext *tc, MVMObject *oshandle, MVMObject *queue,
+        MVMObject *schedulee, MVMObject *pieces, MVMObject *async_type);
 MVMObject * MVM_io_write_bytes_to_async(MVMThreadContext *tc, MVMObject *oshandle, MVMObject *queue,
         MVMObject *schedulee, MVMObject *buffer, MVMObject *async_type, MVMString *host, MVMint64 port);
 MVMint64 MVM_io_eof(MVMThreadContext *tc, MVMObject *oshandle);
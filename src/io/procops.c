@@ -344,6 +344,13 @@ static MVMAsyncTask * write_bytes(MVMThreadContext *tc, MVMOSHandle *h, MVMObjec
     MVM_ASSIGN_REF(tc, &(task->common.header), wi->buf_data, buffer);
     task->body.data = wi;
 
+    /* The process's pipes live on the event loop that spawned it. */
+    {
+        MVMAsyncTask *spawn_task = (MVMAsyncTask *)((MVMIOAsyncProcessData *)h->body.data)->async_task;
+        if (spawn_task)
+            task->body.event_loop = MVM_io_eventloop_for_task(tc, spawn_task);
+    }
+
     /* Hand the task off to the event loop. */
     MVMROOT(tc, task, {
         MVM_io_eventloop_queue_work(tc, (MVMObject *)task);
@@ -398,6 +405,7 @@ static MVMint64 close_stdin(MVMThreadContext *tc, MVMOSHandle *h) {
         });
         task->body.ops  = &deferred_close_op_table;
         task->body.data = si;
+        task->body.event_loop = MVM_io_eventloop_for_task(tc, spawn_task);
         MVM_io_eventloop_queue_work(tc, (MVMObject *)task);
         return 0;
     }
@@ -409,6 +417,7 @@ static MVMint64 close_stdin(MVMThreadContext *tc, MVMOSHandle *h) {
         });
         task->body.ops  = &close_op_table;
         task->body.data = si->stdin_handle;
+        task->body.event_loop = MVM_io_eventloop_for_task(tc, spawn_task);
         MVM_io_eventloop_queue_work(tc, (MVMObject *)task);
         si->stdin_handle = NULL;
     }
@@ -427,6 +436,7 @@ static void deferred_close_perform(MVMThreadContext *tc, uv_loop_t *loop, MVMObj
         });
         task->body.ops  = &deferred_close_op_table;
         task->body.data = si;
+        task->body.event_loop = tc->event_loop;
         MVM_io_eventloop_queue_work(tc, (MVMObject *)task);
         return;
     }
@@ -1218,6 +1228,7 @@ MVMint64 MVM_proc_fork(MVMThreadContext *tc) {
     MVMInstance *instance = tc->instance;
     const char *error = NULL;
     MVMint64 pid = -1;
+    MVMuint32 i;
 
     if (!MVM_platform_supports_fork(tc))
         MVM_exception_throw_adhoc(tc, "This platform does not support fork()");
@@ -1235,8 +1246,10 @@ MVMint64 MVM_proc_fork(MVMThreadContext *tc) {
     MVM_io_eventloop_stop(tc);
     MVM_spesh_worker_join(tc);
     MVM_io_eventloop_join(tc);
-    /* Allow MVM_io_eventloop_start to restart the thread if necessary */
-    instance->event_loop_thread = NULL;
+    /* Allow MVM_io_eventloop_start to restart the threads if necessary */
+    MVM_store(&instance->event_loops_started, 0);
+    for (i = 0; i < instance->num_event_loops; i++)
+        instance->event_loops[i].thread = NULL;
 
     MVM_gc_mark_thread_blocked(tc);
     uv_mutex_lock(&instance->mutex_threads);
@@ -1249,9 +1262,11 @@ MVMint64 MVM_proc_fork(MVMThreadContext *tc) {
         error = "Program has more than one active thread";
     }
 
-    if (pid == 0 && instance->event_loop) {
+    if (pid == 0) {
         /* Reinitialize uv_loop_t after fork in child */
-        uv_loop_fork(instance->event_loop);
+        for (i = 0; i < instance->num_event_loops; i++)
+            if (instance->event_loops[i].loop)
+                uv_loop_fork(instance->event_loops[i].loop);
     }
 
     /* Release the thread lock, otherwise we can't start them */
@@ -1262,7 +1277,7 @@ MVMint64 MVM_proc_fork(MVMThreadContext *tc) {
     /* However, locks are nonrecursive, so unlocking is needed prior to
      * restarting the event loop */
     uv_mutex_unlock(&instance->mutex_event_loop);
-    if (instance->event_loop)
+    if (instance->event_loops[0].loop)
         MVM_io_eventloop_start(tc);
 
     if (error != NULL)
@@ -4,6 +4,8 @@
 #ifndef _WIN32
 #include <sys/types.h>
 #include <unistd.h>
+#include <fcntl.h>
+#include <sys/uio.h>
 #define DEFAULT_MODE 0x01B6
 typedef struct stat STAT_t;
 #else
@@ -26,6 +28,17 @@ typedef struct stat STAT_t;
 typedef struct _stat STAT_t;
 #endif
 
+/* Readahead buffer sizes. It starts at the minimum once reads are seen to be
+ * sequential, then doubles with each refill up to the maximum. Only reads of
+ * at most 1/READAHEAD_SMALL_READ of the buffer's size go through it; bigger
+ * ones gain little from it, and are better off read straight into place. */
+#define READAHEAD_MIN_SIZE 65536
+#define READAHEAD_MAX_SIZE 1048576
+#define READAHEAD_SMALL_READ 4
+
+/* The most pieces we hand to a single writev call. */
+#define WRITEV_MAX_PIECES 64
+
 /* Data that we keep for a file-based handle. */
 typedef struct {
     /* File descriptor. */
@@ -52,6 +65,25 @@ typedef struct {
 
     /* How much of the output buffer has been used so far. */
     size_t output_buffer_used;
+
+    /* May we read ahead? Only for files we opened, and only if seekable,
+     * since giving back unread data means seeking backwards. */
+    short readahead_ok;
+
+    /* Have we told the OS we'll be reading sequentially? */
+    short readahead_advised;
+
+    /* Reads since the last seek, and readahead refills since then. */
+    MVMuint32 sequential_reads;
+    MVMuint32 readahead_refills;
+
+    /* Readahead buffer, its size, the position of the first unread byte in
+     * it and the end of the data in it. The file position is ahead of what
+     * the reader has seen by readahead_used - readahead_pos. */
+    char *readahead;
+    size_t readahead_size;
+    size_t readahead_pos;
+    size_t readahead_used;
 } MVMIOFileData;
 
 /* Checks if the file is a TTY. */
@@ -60,9 +92,21 @@ static MVMint64 is_tty(MVMThreadContext *tc, MVMOSHandle *h) {
     return isatty(data->fd);
 }
 
+/* Gives back whatever is left unread in the readahead buffer by seeking the
+ * file back to where the reader is, so the file position is right for
+ * anything other than a further read. */
+static void discard_readahead(MVMThreadContext *tc, MVMIOFileData *data) {
+    size_t unread = data->readahead_used - data->readahead_pos;
+    data->readahead_pos = data->readahead_used = 0;
+    if (unread && MVM_platform_lseek(data->fd, -(MVMint64)unread, SEEK_CUR) == -1)
+        MVM_exception_throw_adhoc(tc, "Failed to seek in filehandle: %d", errno);
+}
+
 /* Gets the file descriptor. */
 static MVMint64 mvm_fileno(MVMThreadContext *tc, MVMOSHandle *h) {
     MVMIOFileData *data = (MVMIOFileData *)h->body.data;
+    /* Whoever uses the descriptor will expect it to be where we are. */
+    discard_readahead(tc, data);
     return (MVMint64)data->fd;
 }
 
@@ -91,6 +135,48 @@ static void perform_write(MVMThreadContext *tc, MVMIOFileData *data, char *buf,
     data->known_writable = 1;
 }
 
+#ifndef _WIN32
+/* Performs a vectored write of a number of pieces, carrying on where it left
+ * off after a partial write. */
+static void perform_writev(MVMThreadContext *tc, MVMIOFileData *data, MVMIOVecPiece *pieces, MVMuint32 count) {
+    struct iovec iov[WRITEV_MAX_PIECES];
+    MVMuint32    next   = 0;
+    MVMuint64    offset = 0;
+    MVM_gc_mark_thread_blocked(tc);
+    while (next < count) {
+        MVMuint32 i = next;
+        MVMuint64 skip = offset;
+        int       n = 0;
+        ssize_t   r;
+        for (; i < count && n < WRITEV_MAX_PIECES; i++, n++) {
+            iov[n].iov_base = pieces[i].data + skip;
+            iov[n].iov_len  = pieces[i].length - skip;
+            skip = 0;
+        }
+        do {
+            r = writev(data->fd, iov, n);
+        } while (r == -1 && errno == EINTR);
+        if (r == -1) {
+            int save_errno = errno;
+            MVM_gc_mark_thread_unblocked(tc);
+            MVM_exception_throw_adhoc(tc, "Failed to write bytes to filehandle: %s",
+                strerror(save_errno));
+        }
+        data->byte_position += r;
+
+        /* Move past whatever was written. */
+        while (next < count && (MVMuint64)r >= pieces[next].length - offset) {
+            r -= pieces[next].length - offset;
+            offset = 0;
+            next++;
+        }
+        offset += r;
+    }
+    MVM_gc_mark_thread_unblocked(tc);
+    data->known_writable = 1;
+}
+#endif
+
 /* Flushes any existing output buffer and clears use back to 0. */
 static void flush_output_buffer(MVMThreadContext *tc, MVMIOFileData *data) {
     if (data->output_buffer_used) {
@@ -105,8 +191,19 @@ static void seek(MVMThreadContext *tc, MVMOSHandle *h, MVMint64 offset, MVMint64
     if (!data->seekable)
         MVM_exception_throw_adhoc(tc, "It is not possible to seek this kind of handle");
     flush_output_buffer(tc, data);
+    discard_readahead(tc, data);
     if (MVM_platform_lseek(data->fd, offset, whence) == -1)
         MVM_exception_throw_adhoc(tc, "Failed to seek in filehandle: %d", errno);
+
+    /* Access may not be sequential any more. */
+    data->sequential_reads  = 0;
+    data->readahead_refills = 0;
+#ifdef POSIX_FADV_NORMAL
+    if (data->readahead_advised) {
+        posix_fadvise(data->fd, 0, 0, POSIX_FADV_NORMAL);
+        data->readahead_advised = 0;
+    }
+#endif
 }
 
 /* Get current position in the file. */
@@ -117,20 +214,66 @@ static MVMint64 mvm_tell(MVMThreadContext *tc, MVMOSHandle *h) {
         MVMint64 r;
         if ((r = MVM_platform_lseek(data->fd, 0, SEEK_CUR)) == -1)
             MVM_exception_throw_adhoc(tc, "Failed to tell in filehandle: %d", errno);
-        return r;
+        return r - (MVMint64)(data->readahead_used - data->readahead_pos);
     }
     else {
         return data->byte_position;
     }
 }
 
-/* Reads the specified number of bytes into the supplied buffer, returning
- * the number actually read. */
-static MVMint64 read_bytes(MVMThreadContext *tc, MVMOSHandle *h, char **buf_out, MVMuint64 bytes) {
-    MVMIOFileData *data = (MVMIOFileData *)h->body.data;
-    char *buf = MVM_malloc(bytes);
-    unsigned int interval_id = MVM_telemetry_interval_start(tc, "syncfile.read_to_buffer");
+/* Does a single read from the file, retrying if interrupted. Returns the
+ * number of bytes read, or -1 with errno set on failure. */
+static MVMint64 read_fd(MVMThreadContext *tc, MVMIOFileData *data, char *buf, MVMuint64 bytes) {
     MVMint32 bytes_read;
+    do {
+        MVM_gc_mark_thread_blocked(tc);
+        bytes_read = read(data->fd, buf, bytes);
+        MVM_gc_mark_thread_unblocked(tc);
+    } while(bytes_read == -1 && errno == EINTR);
+    return bytes_read;
+}
+
+/* Works out the size the readahead buffer will have on its next refill. */
+static size_t next_readahead_size(MVMIOFileData *data) {
+    size_t    size = READAHEAD_MIN_SIZE;
+    MVMuint32 i;
+    for (i = 0; i < data->readahead_refills && size < READAHEAD_MAX_SIZE; i++)
+        size *= 2;
+    return size;
+}
+
+/* Refills the readahead buffer, growing it if reads keep on being
+ * sequential. Returns the number of bytes read, or -1 on failure. */
+static MVMint64 refill_readahead(MVMThreadContext *tc, MVMIOFileData *data) {
+    size_t    wanted = next_readahead_size(data);
+    MVMint64  got;
+    if (wanted != data->readahead_size) {
+        /* Nothing unread is left in it, so no need to copy. */
+        MVM_free(data->readahead);
+        data->readahead      = MVM_malloc(wanted);
+        data->readahead_size = wanted;
+    }
+#ifdef POSIX_FADV_SEQUENTIAL
+    if (wanted == READAHEAD_MAX_SIZE && !data->readahead_advised) {
+        posix_fadvise(data->fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+        data->readahead_advised = 1;
+    }
+#endif
+    if (wanted < READAHEAD_MAX_SIZE)
+        data->readahead_refills++;
+    data->readahead_pos = 0;
+    got = read_fd(tc, data, data->readahead, wanted);
+    data->readahead_used = got > 0 ? (size_t)got : 0;
+    return got;
+}
+
+/* Reads up to the specified number of bytes into the supplied buffer,
+ * returning the number actually read, or -1 with errno set on failure. Once
+ * reads are seen to be sequential, small ones are served from a readahead
+ * buffer; larger ones take what it still holds, and read the rest directly. */
+static MVMint64 read_into(MVMThreadContext *tc, MVMIOFileData *data, char *buf, MVMuint64 bytes) {
+    unsigned int interval_id = MVM_telemetry_interval_start(tc, "syncfile.read_to_buffer");
+    MVMint64 bytes_read = 0;
 #ifdef _WIN32
     /* Can only perform relatively small reads from a Windows console;
      * trying to do larger ones gives back ENOMEM, most likely due to
@@ -139,23 +282,74 @@ static MVMint64 read_bytes(MVMThreadContext *tc, MVMOSHandle *h, char **buf_out,
         bytes = 16387;
 #endif
     flush_output_buffer(tc, data);
-    do {
-        MVM_gc_mark_thread_blocked(tc);
-        bytes_read = read(data->fd, buf, bytes);
-        MVM_gc_mark_thread_unblocked(tc);
-    } while(bytes_read == -1 && errno == EINTR);
-    if (bytes_read  == -1) {
+
+    /* Take what we can from the readahead buffer. */
+    if (data->readahead_pos < data->readahead_used) {
+        size_t available = data->readahead_used - data->readahead_pos;
+        bytes_read = bytes < available ? bytes : available;
+        memcpy(buf, data->readahead + data->readahead_pos, bytes_read);
+        data->readahead_pos += bytes_read;
+    }
+
+    /* Read the rest, via the readahead buffer if it's a small read in a
+     * sequence of them. */
+    if ((MVMuint64)bytes_read < bytes) {
+        MVMuint64 wanted = bytes - bytes_read;
+        MVMint64  got;
+        if (data->readahead_ok && data->sequential_reads
+                && wanted * READAHEAD_SMALL_READ <= next_readahead_size(data)) {
+            got = refill_readahead(tc, data);
+            if (got > 0) {
+                if ((MVMuint64)got > wanted)
+                    got = wanted;
+                memcpy(buf + bytes_read, data->readahead, got);
+                data->readahead_pos = got;
+            }
+        }
+        else {
+            got = read_fd(tc, data, buf + bytes_read, wanted);
+        }
+        if (got == -1) {
+            /* Keep errno for the caller's error. */
+            MVM_telemetry_interval_stop(tc, interval_id, "syncfile.read_to_buffer failed");
+            return -1;
+        }
+        if (got == 0 && bytes_read == 0)
+            data->eof_reported = 1;
+        bytes_read += got;
+    }
+    data->sequential_reads++;
+
+    MVM_telemetry_interval_annotate(bytes_read, interval_id, "read this many bytes");
+    MVM_telemetry_interval_stop(tc, interval_id, "syncfile.read_to_buffer");
+    data->byte_position += bytes_read;
+    return bytes_read;
+}
+
+/* Reads the specified number of bytes into a freshly allocated buffer,
+ * returning the number actually read. */
+static MVMint64 read_bytes(MVMThreadContext *tc, MVMOSHandle *h, char **buf_out, MVMuint64 bytes) {
+    MVMIOFileData *data = (MVMIOFileData *)h->body.data;
+    char *buf = MVM_malloc(bytes);
+    MVMint64 bytes_read = read_into(tc, data, buf, bytes);
+    if (bytes_read == -1) {
         int save_errno = errno;
         MVM_free(buf);
         MVM_exception_throw_adhoc(tc, "Reading from filehandle failed: %s",
             strerror(save_errno));
     }
     *buf_out = buf;
-    MVM_telemetry_interval_annotate(bytes_read, interval_id, "read this many bytes");
-    MVM_telemetry_interval_stop(tc, interval_id, "syncfile.read_to_buffer");
-    data->byte_position += bytes_read;
-    if (bytes_read == 0 && bytes != 0)
-        data->eof_reported = 1;
+    return bytes_read;
+}
+
+/* Reads the specified number of bytes into a buffer the caller supplies,
+ * which is at least that big, returning the number actually read. */
+static MVMint64 read_bytes_into(MVMThreadContext *tc, MVMOSHandle *h, char *buf, MVMuint64 bytes) {
+    MVMIOFileData *data = (MVMIOFileData *)h->body.data;
+    MVMint64 bytes_read = read_into(tc, data, buf, bytes);
+    if (bytes_read == -1)
+        MVM_exception_throw_adhoc(tc, "Reading from filehandle failed: %s",
+            strerror(errno));
     return bytes_read;
 }
 
@@ -168,6 +362,8 @@ static MVMint64 mvm_eof(MVMThreadContext *tc, MVMOSHandle *h) {
         if (fstat(data->fd, &statbuf) == -1)
             MVM_exception_throw_adhoc(tc, "Failed to stat file descriptor: %s",
                 strerror(errno));
+        if (data->readahead_pos < data->readahead_used)
+            return 0;
         if ((seek_pos = MVM_platform_lseek(data->fd, 0, SEEK_CUR)) == -1)
             MVM_exception_throw_adhoc(tc, "Failed to seek in filehandle: %d", errno);
         /* For some special files, like those in /proc, the file size is 0,
@@ -203,6 +399,7 @@ static void set_buffer_size(MVMThreadContext *tc, MVMOSHandle *h, MVMint64 size)
 /* Writes the specified bytes to the file handle. */
 static MVMint64 write_bytes(MVMThreadContext *tc, MVMOSHandle *h, char *buf, MVMuint64 bytes) {
     MVMIOFileData *data = (MVMIOFileData *)h->body.data;
+    discard_readahead(tc, data);
     if (data->output_buffer_size && data->known_writable) {
         /* If we can't fit it on the end of the buffer, flush the buffer. */
         if (data->output_buffer_used + bytes > data->output_buffer_size)
@@ -220,6 +417,37 @@ static MVMint64 write_bytes(MVMThreadContext *tc, MVMOSHandle *h, char *buf, MVM
     return bytes;
 }
 
+/* Writes a number of pieces to the file handle, with as few system calls as
+ * possible. */
+static MVMint64 write_bytes_v(MVMThreadContext *tc, MVMOSHandle *h, MVMIOVecPiece *pieces, MVMuint32 count) {
+    MVMIOFileData *data  = (MVMIOFileData *)h->body.data;
+    MVMuint64      total = 0;
+    MVMuint32      i;
+    for (i = 0; i < count; i++)
+        total += pieces[i].length;
+    discard_readahead(tc, data);
+    if (data->output_buffer_size && data->known_writable) {
+        /* If it all fits in the output buffer, copy it there. */
+        if (data->output_buffer_used + total > data->output_buffer_size)
+            flush_output_buffer(tc, data);
+        if (total < data->output_buffer_size) {
+            for (i = 0; i < count; i++) {
+                memcpy(data->output_buffer + data->output_buffer_used, pieces[i].data,
+                    pieces[i].length);
+                data->output_buffer_used += pieces[i].length;
+            }
+            return total;
+        }
+    }
+#ifdef _WIN32
+    for (i = 0; i < count; i++)
+        perform_write(tc, data, pieces[i].data, pieces[i].length);
+#else
+    perform_writev(tc, data, pieces, count);
+#endif
+    return total;
+}
+
 /* Flushes the file handle. */
 static void flush(MVMThreadContext *tc, MVMOSHandle *h, MVMint32 sync){
     MVMIOFileData *data = (MVMIOFileData *)h->body.data;
@@ -242,6 +470,7 @@ static void flush(MVMThreadContext *tc, MVMOSHandle *h, MVMint32 sync){
 /* Truncates the file handle. */
 static void truncatefh(MVMThreadContext *tc, MVMOSHandle *h, MVMint64 bytes) {
     MVMIOFileData *data = (MVMIOFileData *)h->body.data;
+    discard_readahead(tc, data);
     if (ftruncate(data->fd, bytes) == -1)
         MVM_exception_throw_adhoc(tc, "Failed to truncate filehandle: %s", strerror(errno));
 }
@@ -253,6 +482,8 @@ static MVMint64 closefh(MVMThreadContext *tc, MVMOSHandle *h) {
         int r;
         flush_output_buffer(tc, data);
         MVM_free_null(data->output_buffer);
+        MVM_free_null(data->readahead);
+        data->readahead_pos = data->readahead_used = 0;
         r = close(data->fd);
         data->fd = -1;
         if (r == -1)
@@ -374,14 +605,15 @@ static void gc_free(MVMThreadContext *tc, MVMObject *h, void *d) {
     MVMIOFileData *data = (MVMIOFileData *)d;
     if (data) {
         MVM_free(data->output_buffer);
+        MVM_free(data->readahead);
         MVM_free(data);
     }
 }
 
 /* IO ops table, populated with functions. */
 static const MVMIOClosable      closable      = { closefh };
-static const MVMIOSyncReadable  sync_readable = { read_bytes, mvm_eof };
-static const MVMIOSyncWritable  sync_writable = { write_bytes, flush, truncatefh };
+static const MVMIOSyncReadable  sync_readable = { read_bytes, mvm_eof, read_bytes_into };
+static const MVMIOSyncWritable  sync_writable = { write_bytes, flush, truncatefh, write_bytes_v };
 static const MVMIOSeekable      seekable      = { seek, mvm_tell };
 static const MVMIOLockable      lockable      = { lock, unlock };
 static const MVMIOIntrospection introspection = { is_tty, mvm_fileno };
@@ -404,7 +636,7 @@ static const MVMIOOps op_table = {
 };
 
 /* Builds POSIX flag from mode string. */
-static int resolve_open_mode(int *flag, const char *cp) {
+int MVM_file_resolve_open_mode(int *flag, const char *cp) {
     switch (*cp++) {
         case 'r': *flag = O_RDONLY; break;
         case '-': *flag = O_WRONLY; break;
@@ -442,7 +674,7 @@ MVMObject * MVM_file_open_fh(MVMThreadContext *tc, MVMString *filename, MVMStrin
 
     /* Resolve mode description to flags. */
     char * const fmode  = MVM_string_utf8_encode_C_string(tc, mode);
-    if (!resolve_open_mode(&flag, fmode)) {
+    if (!MVM_file_resolve_open_mode(&flag, fmode)) {
         char *waste[] = { fname, fmode, NULL };
         MVM_exception_throw_adhoc_free(tc, waste,
             "Invalid open mode for file %s: %s", fname, fmode);
@@ -482,10 +714,11 @@ MVMObject * MVM_file_open_fh(MVMThreadContext *tc, MVMString *filename, MVMStrin
         MVMIOFileData * const data   = MVM_calloc(1, sizeof(MVMIOFileData));
         MVMOSHandle   * const result = (MVMOSHandle *)MVM_repr_alloc_init(tc,
             tc->instance->boot_types.BOOTIO);
-        data->fd          = fd;
-        data->seekable    = MVM_platform_is_fd_seekable(fd);
-        result->body.ops  = &op_table;
-        result->body.data = data;
+        data->fd           = fd;
+        data->seekable     = MVM_platform_is_fd_seekable(fd);
+        data->readahead_ok = data->seekable;
+        result->body.ops   = &op_table;
+        result->body.data  = data;
         return (MVMObject *)result;
     }
 }
@@ -1,2 +1,3 @@
 MVMObject * MVM_file_open_fh(MVMThreadContext *tc, MVMString *filename, MVMString *mode);
 MVMObject * MVM_file_handle_from_fd(MVMThreadContext *tc, uv_file fd);
+int MVM_file_resolve_open_mode(int *flag, const char *cp);
@@ -239,6 +239,13 @@ MVMJitCode * MVM_jit_compiler_assemble(MVMThreadContext *tc, MVMJitCompiler *cl,
     code->num_inlines  = jg->inlines_num;
     code->inlines      = COPY_ARRAY(jg->inlines, jg->inlines_alloc);
 
+    /* The attribute caches are referenced directly from the machine code, so
+     * rather than copy them, transfer ownership */
+    code->num_attr_caches = jg->attr_caches_num;
+    code->attr_caches     = jg->attr_caches;
+    jg->attr_caches       = NULL;
+    jg->attr_caches_num   = 0;
+
 
     return code;
 }
@@ -249,6 +256,7 @@ MVMJitCode* MVM_jit_code_copy(MVMThreadContext *tc, MVMJitCode * const code) {
 }
 
 void MVM_jit_code_destroy(MVMThreadContext *tc, MVMJitCode *code) {
+    MVMuint32 i;
     /* fetch_and_sub1 returns previous value, so check if there's only 1 reference */
     if (AO_fetch_and_sub1(&code->ref_cnt) > 1)
         return;
@@ -257,6 +265,9 @@ void MVM_jit_code_destroy(MVMThreadContext *tc, MVMJitCode *code) {
     MVM_free(code->deopts);
     MVM_free(code->handlers);
     MVM_free(code->inlines);
+    for (i = 0; i < code->num_attr_caches; i++)
+        MVM_free(code->attr_caches[i]);
+    MVM_free(code->attr_caches);
     MVM_free(code->local_types);
     MVM_free(code);
 }
@@ -326,6 +337,9 @@ void MVM_jit_compile_expr_tree(MVMThreadContext *tc, MVMJitCompiler *compiler, M
     /* Second stage, allocate registers */
     MVM_jit_linear_scan_allocate(tc, compiler, list);
 
+    /* Clean up after the register allocator */
+    MVM_jit_tile_list_peephole(tc, compiler, list);
+
     /* Allocate sufficient space for the new internal labels */
     dasm_growpc(compiler, compiler->label_offset);
 
@@ -23,6 +23,9 @@ struct MVMJitCode {
     MVMJitInline  *inlines;
     MVMJitHandler *handlers;
 
+    MVMuint32      num_attr_caches;
+    MVMAttrCache **attr_caches;
+
     MVMuint32      spill_size;
     MVMuint32      seq_nr;
 
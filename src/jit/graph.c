@@ -103,6 +103,15 @@ static void jg_append_label(MVMThreadContext *tc, MVMJitGraph *jg, MVMint32 name
     jg->label_nodes[name] = node;
 }
 
+/* Allocates an inline cache for a (non-devirtualized) attribute access site.
+ * These are owned by the graph until the code is assembled, after which they
+ * live as long as the JIT code itself. */
+static MVMAttrCache * jg_add_attr_cache(MVMThreadContext *tc, MVMJitGraph *jg) {
+    MVMAttrCache *cache = MVM_calloc(1, sizeof(MVMAttrCache));
+    MVM_VECTOR_PUSH(jg->attr_caches, cache);
+    return cache;
+}
+
 static void * op_to_func(MVMThreadContext *tc, MVMint16 opcode) {
     switch(opcode) {
     case MVM_OP_checkarity: return MVM_args_checkarity;
@@ -987,10 +996,11 @@ static MVMint32 consume_reprop(MVMThreadContext *tc, MVMJitGraph *jg,
                 if (is_double_devirt) {
                     MVMJitCallArg args[] = { { MVM_JIT_INTERP_VAR,  MVM_JIT_INTERP_TC },
                                              { MVM_JIT_REG_STABLE,  invocant },
+                                             { MVM_JIT_REG_VAL,     invocant },
                                              { MVM_JIT_REG_OBJBODY, invocant },
                                              { MVM_JIT_REG_VAL, key },
                                              { MVM_JIT_REG_VAL, value } };
-                    jg_append_call_c(tc, jg, function, 5, args, MVM_JIT_RV_VOID, -1);
+                    jg_append_call_c(tc, jg, function, 6, args, MVM_JIT_RV_VOID, -1);
                 }
                 else {
                     MVMJitCallArg args[] = { { MVM_JIT_INTERP_VAR,  MVM_JIT_INTERP_TC },
@@ -1564,6 +1574,10 @@ skipdevirt:
                          op == MVM_OP_getattr_n ? MVM_JIT_RV_NUM :
                          op == MVM_OP_getattr_s ? MVM_JIT_RV_PTR :
                          /* MVM_OP_getattr_o ? */ MVM_JIT_RV_PTR;
+        void *function = op == MVM_OP_getattr_i ? (void *)MVM_repr_get_attr_i_cached :
+                         op == MVM_OP_getattr_n ? (void *)MVM_repr_get_attr_n_cached :
+                         op == MVM_OP_getattr_s ? (void *)MVM_repr_get_attr_s_cached :
+                         /* MVM_OP_getattr_o ? */ (void *)MVM_repr_get_attr_o_cached;
         MVMint16 dst = ins->operands[0].reg.orig;
         MVMint16 obj = ins->operands[1].reg.orig;
         MVMint16 typ = ins->operands[2].reg.orig;
@@ -1573,8 +1587,9 @@ skipdevirt:
                                  { MVM_JIT_REG_VAL, obj },
                                  { MVM_JIT_REG_VAL, typ },
                                  { MVM_JIT_STR_IDX, str_idx },
-                                 { MVM_JIT_LITERAL, hint }};
-        jg_append_call_c(tc, jg, op_to_func(tc, op), 5, args, kind, dst);
+                                 { MVM_JIT_LITERAL, hint },
+                                 { MVM_JIT_LITERAL_PTR, { (uintptr_t)jg_add_attr_cache(tc, jg) } } };
+        jg_append_call_c(tc, jg, function, 6, args, kind, dst);
         break;
     }
     case MVM_OP_getattrs_i:
@@ -1630,8 +1645,9 @@ skipdevirt:
                                  { MVM_JIT_STR_IDX, str_idx },
                                  { MVM_JIT_LITERAL, hint },
                                  { MVM_JIT_REG_VAL, val }, /* Takes MVMRegister, so no _F needed. */
-                                 { MVM_JIT_LITERAL, kind } };
-        jg_append_call_c(tc, jg, op_to_func(tc, op), 7, args, MVM_JIT_RV_VOID, -1);
+                                 { MVM_JIT_LITERAL, kind },
+                                 { MVM_JIT_LITERAL_PTR, { (uintptr_t)jg_add_attr_cache(tc, jg) } } };
+        jg_append_call_c(tc, jg, MVM_repr_bind_attr_inso_cached, 8, args, MVM_JIT_RV_VOID, -1);
         jg_sc_wb(tc, jg, ins->operands[0]);
         break;
     }
@@ -4015,6 +4031,8 @@ MVMJitGraph * MVM_jit_try_make_graph(MVMThreadContext *tc, MVMSpeshGraph *sg) {
 
     /* Deoptimization labels */
     MVM_VECTOR_INIT(graph->deopts, 8);
+    /* Inline caches for attribute access sites */
+    MVM_VECTOR_INIT(graph->attr_caches, 0);
     /* Nodes for each label, used to ensure labels aren't added twice */
     MVM_VECTOR_INIT(graph->label_nodes, 16 + sg->num_bbs);
 
@@ -4065,6 +4083,7 @@ MVMJitGraph * MVM_jit_try_make_graph(MVMThreadContext *tc, MVMSpeshGraph *sg) {
 
 void MVM_jit_graph_destroy(MVMThreadContext *tc, MVMJitGraph *graph) {
     MVMJitNode *node;
+    MVMuint32 i;
     /* destroy all trees */
     for (node = graph->first_node; node != NULL; node = node->next) {
         if (node->type == MVM_JIT_NODE_EXPR_TREE) {
@@ -4076,4 +4095,8 @@ void MVM_jit_graph_destroy(MVMThreadContext *tc, MVMJitGraph *graph) {
     MVM_free(graph->deopts);
     MVM_free(graph->handlers);
     MVM_free(graph->inlines);
+    /* attribute caches, unless they've been handed to the code */
+    for (i = 0; i < graph->attr_caches_num; i++)
+        MVM_free(graph->attr_caches[i]);
+    MVM_free(graph->attr_caches);
 }
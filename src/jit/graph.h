@@ -22,6 +22,9 @@ struct MVMJitGraph {
     MVM_VECTOR_DECL(MVMJitHandler, handlers);
     MVM_VECTOR_DECL(MVMJitInline, inlines);
     MVM_VECTOR_DECL(MVMJitNode*, label_nodes);
+
+    /* Inline caches allocated for attribute access sites */
+    MVM_VECTOR_DECL(MVMAttrCache*, attr_caches);
 };
 
 struct MVMJitDeopt {
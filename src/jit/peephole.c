@@ -0,0 +1,135 @@
+#include "moar.h"
+#include "internal.h"
+
+/* A late peephole pass over the tile list, run after register allocation but
+ * before code emission. The register allocator works one live range at a
+ * time, and so it frequently inserts synthetic tiles that are redundant when
+ * looked at together: a load of a spilled value into a register that already
+ * holds it, a store of a value right back to the slot it came from, or a
+ * move between two registers that hold the same value. And the tiler emits
+ * unconditional branches to labels that immediately follow them.
+ *
+ * We only ever reason about the synthetic tiles, since those are the only
+ * ones we know the exact effects of. For template tiles we rely on the
+ * contract that they write only to their output register and the spare
+ * registers. Tiles that are removed get their emit rule set to NULL (like
+ * definition tiles), so the list and its basic blocks remain valid. */
+
+#define UNKNOWN_SLOT -1
+
+typedef struct {
+    /* For each register, the local spill slot it holds a copy of, if any */
+    MVMint32 holds[MVM_JIT_ARCH_NUM_REG];
+    MVMuint32 removed;
+} Peephole;
+
+static void forget_everything(Peephole *ph) {
+    MVMuint32 i;
+    for (i = 0; i < MVM_JIT_ARCH_NUM_REG; i++)
+        ph->holds[i] = UNKNOWN_SLOT;
+}
+
+static void forget_slot(Peephole *ph, MVMint32 slot) {
+    MVMuint32 i;
+    for (i = 0; i < MVM_JIT_ARCH_NUM_REG; i++)
+        if (ph->holds[i] == slot)
+            ph->holds[i] = UNKNOWN_SLOT;
+}
+
+static void forget_spare_registers(Peephole *ph) {
+    MVMuint32 i;
+    for (i = 0; i < MVM_JIT_ARCH_NUM_REG; i++)
+        if (MVM_bitmap_get_low(MVM_JIT_SPARE_REGISTERS, i))
+            ph->holds[i] = UNKNOWN_SLOT;
+}
+
+static void remove_tile(Peephole *ph, MVMJitTile *tile) {
+    tile->emit = NULL;
+    ph->removed++;
+}
+
+/* Does this tile transfer control, or can it be jumped to? In either case we
+ * can no longer assume anything about register contents. */
+static MVMint32 is_barrier(MVMJitTile *tile) {
+    if (tile->emit == MVM_jit_compile_label || tile->emit == MVM_jit_compile_guard)
+        return 1;
+    return tile->op == MVM_JIT_MARK || tile->op == MVM_JIT_GUARD
+        || MVM_jit_expr_op_is_call(tile->op);
+}
+
+/* Find the next tile that will actually emit code. */
+static MVMJitTile * next_real_tile(MVMJitTileList *list, MVMuint32 i) {
+    while (++i < list->items_num)
+        if (list->items[i]->emit != NULL)
+            return list->items[i];
+    return NULL;
+}
+
+void MVM_jit_tile_list_peephole(MVMThreadContext *tc, MVMJitCompiler *compiler, MVMJitTileList *list) {
+    Peephole ph;
+    MVMuint32 i;
+
+    ph.removed = 0;
+    forget_everything(&ph);
+
+    for (i = 0; i < list->items_num; i++) {
+        MVMJitTile *tile = list->items[i];
+        if (tile->emit == NULL) {
+            continue;
+        }
+        else if (tile->emit == MVM_jit_compile_move) {
+            MVMint8 dst = tile->values[0], src = tile->values[1];
+            if (dst == src || (ph.holds[dst] != UNKNOWN_SLOT && ph.holds[dst] == ph.holds[src]))
+                remove_tile(&ph, tile);
+            else
+                ph.holds[dst] = ph.holds[src];
+        }
+        else if (tile->emit == MVM_jit_compile_load) {
+            MVMint8 dst = tile->values[0];
+            if (tile->args[0] != MVM_JIT_STORAGE_LOCAL)
+                ph.holds[dst] = UNKNOWN_SLOT;
+            else if (ph.holds[dst] == tile->args[1])
+                remove_tile(&ph, tile);
+            else
+                ph.holds[dst] = tile->args[1];
+        }
+        else if (tile->emit == MVM_jit_compile_store) {
+            MVMint8 src = tile->values[1];
+            if (tile->args[0] == MVM_JIT_STORAGE_LOCAL) {
+                if (ph.holds[src] == tile->args[1]) {
+                    remove_tile(&ph, tile);
+                }
+                else {
+                    forget_slot(&ph, tile->args[1]);
+                    ph.holds[src] = tile->args[1];
+                }
+            }
+        }
+        else if (tile->emit == MVM_jit_compile_memory_copy) {
+            ph.holds[tile->values[1]] = UNKNOWN_SLOT;
+            if (tile->args[0] == MVM_JIT_STORAGE_LOCAL)
+                forget_slot(&ph, tile->args[1]);
+        }
+        else if (tile->emit == MVM_jit_compile_branch) {
+            /* A jump to the label right after us is a no-op */
+            MVMJitTile *next = next_real_tile(list, i);
+            if (next != NULL && next->emit == MVM_jit_compile_label && next->args[0] == tile->args[0])
+                remove_tile(&ph, tile);
+        }
+        else if (tile->emit == MVM_jit_compile_conditional_branch) {
+            /* Doesn't touch registers, and on fallthrough everything we
+             * knew still holds */
+        }
+        else if (is_barrier(tile)) {
+            forget_everything(&ph);
+        }
+        else {
+            if (MVM_JIT_TILE_YIELDS_VALUE(tile))
+                ph.holds[tile->values[0]] = UNKNOWN_SLOT;
+            forget_spare_registers(&ph);
+        }
+    }
+
+    if (ph.removed > 0 && MVM_jit_debug_enabled(tc))
+        MVM_spesh_debug_printf(tc, "JIT peephole removed %u tiles\n", ph.removed);
+}
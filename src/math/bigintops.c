@@ -915,7 +915,8 @@ MVMObject * MVM_coerce_sI(MVMThreadContext *tc, MVMString *s, MVMObject *type) {
     switch (s->body.storage_type) {
         case MVM_STRING_GRAPHEME_ASCII:
         case MVM_STRING_GRAPHEME_8:
-            memcpy(buf, s->body.storage.blob_8, sizeof(MVMGrapheme8) * s->body.num_graphs);
+        case MVM_STRING_IN_SITU_8:
+            memcpy(buf, MVM_string_blob_8(s), sizeof(MVMGrapheme8) * s->body.num_graphs);
             break;
         case MVM_STRING_GRAPHEME_32:
             for (i = 0; i < s->body.num_graphs; i++) {
@@ -97,6 +97,7 @@ MVMInstance * MVM_vm_create_instance(void) {
     char *jit_expr_disable, *jit_disable, *jit_last_frame, *jit_last_bb;
     char *dynvar_log;
     int init_stat;
+    MVMuint32 i;
 
     /* Set up instance data structure. */
     instance = MVM_calloc(1, sizeof(MVMInstance));
@@ -117,6 +118,13 @@ MVMInstance * MVM_vm_create_instance(void) {
     instance->hashSecrets[0] = 0;
     instance->hashSecrets[1] = 0;
 #endif
+    {
+        char *string_hash = getenv("MVM_STRING_HASH");
+        if (string_hash && strcmp(string_hash, "siphash24") == 0)
+            instance->string_hash_siphash24 = 1;
+        else if (string_hash && strcmp(string_hash, "siphash13") != 0)
+            fprintf(stderr, "MVM_STRING_HASH must be siphash13 or siphash24; using siphash13\n");
+    }
     instance->main_thread->thread_id = 1;
 
     /* Next thread to be created gets ID 2 (the main thread got ID 1). */
@@ -168,6 +176,11 @@ MVMInstance * MVM_vm_create_instance(void) {
     init_mutex(instance->mutex_sc_registry, "sc registry");
     MVM_str_hash_build(instance->main_thread, &instance->sc_weakhash, sizeof(struct MVMSerializationContextWeakHashEntry), 0);
 
+    /* Set up string interning table mutex. */
+    init_mutex(instance->mutex_string_interns, "string interns");
+    MVM_str_hash_build(instance->main_thread, &instance->string_interns, sizeof(struct MVMStringInternEntry), 0);
+    instance->string_interning = getenv("MVM_STRING_INTERN") ? 1 : 0;
+
     /* Set up loaded compunits hash mutex. */
     init_mutex(instance->mutex_loaded_compunits, "loaded compunits");
     MVM_fixkey_hash_build(instance->main_thread, &instance->loaded_compunits, sizeof(MVMString *));
@@ -199,8 +212,21 @@ MVMInstance * MVM_vm_create_instance(void) {
     /* Set up main thread's last_payload. */
     instance->main_thread->last_payload = instance->VMNull;
 
-    /* Initialize event loop thread starting mutex. */
+    /* Initialize event loop thread starting mutex, and set up the event
+     * loops; their threads are started on first use. */
     init_mutex(instance->mutex_event_loop, "event loop thread start");
+    {
+        char *event_loops = getenv("MVM_EVENT_LOOPS");
+        MVMint64 num = event_loops ? atoi(event_loops) : 1;
+        if (num < 1)
+            num = 1;
+        if (num > MVM_IO_EVENT_LOOPS_MAX)
+            num = MVM_IO_EVENT_LOOPS_MAX;
+        instance->num_event_loops = (MVMuint32)num;
+        instance->event_loops = MVM_calloc(num, sizeof(MVMIOEventLoop));
+        for (i = 0; i < instance->num_event_loops; i++)
+            instance->event_loops[i].index = i;
+    }
 
     /* Create main thread object, and also make it the start of the all threads
      * linked list. Set up the mutex to protect it. */
@@ -613,6 +639,7 @@ static void cleanup_callsite_interns(MVMInstance *instance) {
  * should clear up all resources and free all memory; in practice, it falls
  * short of this goal at the moment. */
 void MVM_vm_destroy_instance(MVMInstance *instance) {
+    MVMuint32 i;
 
     /* Join any foreground threads and flush standard handles. */
     MVM_thread_join_foreground(instance->main_thread);
@@ -672,6 +699,10 @@ void MVM_vm_destroy_instance(MVMInstance *instance) {
     uv_mutex_destroy(&instance->mutex_sc_registry);
     MVM_str_hash_demolish(instance->main_thread, &instance->sc_weakhash);
 
+    /* Clean up string interning table; the strings in it are gone by now. */
+    uv_mutex_destroy(&instance->mutex_string_interns);
+    MVM_str_hash_demolish(instance->main_thread, &instance->string_interns);
+
     /* Clean up Hash of filenames of compunits loaded from disk. */
     uv_mutex_destroy(&instance->mutex_loaded_compunits);
     MVM_fixkey_hash_demolish(instance->main_thread, &instance->loaded_compunits);
@@ -722,13 +753,22 @@ void MVM_vm_destroy_instance(MVMInstance *instance) {
     uv_mutex_destroy(&instance->nfg->update_mutex);
     MVM_nfg_destroy(instance->main_thread);
 
+    /* Clean up character class tables. */
+    for (i = 0; i < 256; i++)
+        MVM_free(instance->cclass_blocks[i]);
+
+    /* Clean up 8-bit case change tables. */
+    for (i = 0; i < 4; i++)
+        MVM_free(instance->case_change_8bit[i]);
+
 
     /* Clean up integer constant and string cache. */
     uv_mutex_destroy(&instance->mutex_int_const_cache);
     MVM_free(instance->int_const_cache);
     MVM_free(instance->int_to_str_cache);
 
-    /* Clean up event loop mutex. */
+    /* Clean up event loops and their mutex. */
+    MVM_free(instance->event_loops);
     uv_mutex_destroy(&instance->mutex_event_loop);
 
     /* Destroy main thread contexts and thread list mutex. */
@@ -193,6 +193,7 @@ MVM_PUBLIC MVMint32 MVM_jit_support(void);
 #include "strings/utf16.h"
 #include "strings/iter.h"
 #include "strings/ops.h"
+#include "strings/intern.h"
 #include "core/fixedsizealloc.h"
 #include "io/procops.h"
 #include "core/str_hash_table_funcs.h"
@@ -221,6 +222,7 @@ MVM_PUBLIC MVMint32 MVM_jit_support(void);
 #include "io/signals.h"
 #include "io/asyncsocket.h"
 #include "io/asyncsocketudp.h"
+#include "io/asyncfile.h"
 #include "math/bigintops.h"
 #include "core/intcache.h"
 #include "jit/graph.h"
@@ -30,6 +30,20 @@
 #if 8 <= MVM_PTR_SIZE && defined(MVM_CAN_UNALIGNED_INT64)
 #define USE_MEMMEM_TWO_UINT32 1
 #endif
+/* SSE2 is part of the x86-64 baseline, so when the compiler says we have it
+ * there is no need for runtime CPU detection. We compare 4 graphemes (or 16
+ * bytes) at a time and use the movemask to find the first lane of interest. */
+#if defined(__SSE2__) && (defined(__GNUC__) || defined(__clang__))
+#define USE_SSE2 1
+#include <emmintrin.h>
+#define FIRST_LANE(mask) ((size_t)__builtin_ctz((unsigned int)(mask)))
+/* SSSE3 isn't baseline, so this is only used if the compiler was told it can
+ * use it (for example, with -march=native). */
+#if defined(__SSSE3__)
+#define USE_SSSE3 1
+#include <tmmintrin.h>
+#endif
+#endif
 
 /* This is a modification of the memmem used in FreeBSD to allow us to quickly
  * search 32 bit strings. This is much more efficient than searching by byte
@@ -45,6 +59,14 @@ static uint32_t * memmem_one_uint32(const uint32_t *h0, const uint32_t *n0, cons
 	uint32_t *h           = (uint32_t*)h0;
 	const uint32_t  n     = *n0;
 	const uint32_t *end_h = end_h0 - 1;
+#if defined(USE_SSE2)
+	const __m128i needle = _mm_set1_epi32((int)n);
+	for (; h + 4 <= end_h0; h += 4) {
+		__m128i eq = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)h), needle);
+		int mask = _mm_movemask_epi8(eq);
+		if (mask) return h + (FIRST_LANE(mask) >> 2);
+	}
+#endif
 	for (; h <= end_h; h++) {
 		if (*h == n) return h;
 	}
@@ -59,6 +81,19 @@ static uint32_t * memmem_two_uint32(const uint32_t *h0, const uint32_t *n0, cons
 	uint32_t *h           = (uint32_t*)h0;
 	const uint64_t  n     = *((uint64_t*)n0);
 	const uint32_t *end_h = end_h0 - 2;
+#if defined(USE_SSE2)
+	/* Compare the first needle element against h[0..3] and the second one
+	 * against h[1..4]; both matching in a lane means a match at that lane. */
+	const __m128i first  = _mm_set1_epi32((int)n0[0]),
+	              second = _mm_set1_epi32((int)n0[1]);
+	for (; h + 5 <= end_h0; h += 4) {
+		__m128i eq = _mm_and_si128(
+			_mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)h), first),
+			_mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)(h + 1)), second));
+		int mask = _mm_movemask_epi8(eq);
+		if (mask) return h + (FIRST_LANE(mask) >> 2);
+	}
+#endif
 	for (; h <= end_h; h++) {
 		if (*((uint64_t*)h) == n) return h;
 	}
@@ -140,7 +175,7 @@ static char *twoway_memmem_uint32(const uint32_t *h, const uint32_t *z, const ui
 	else p = p0;
 
 	/* Periodic needle? */
-	if (memcmp(n, n+p, ms+1)) {
+	if (memcmp(n, n+p, (ms+1) * sizeof(uint32_t))) {
 		mem0 = 0;
 		p = MVM_MAX(ms, l-ms-1) + 1;
 	} else mem0 = l-p;
@@ -228,3 +263,152 @@ void * memmem_uint32(const void *h0, size_t H_len, const void *n0, size_t n_len)
 
 	return twoway_memmem_uint32(h, h+H_len, n, n_len);
 }
+
+/* Returns the index of the first element at which the two buffers differ, or
+ * len if they are identical. Used by string comparison, where memcmp isn't
+ * enough since we need the position, not just the ordering of the bytes. */
+size_t mismatch_uint32(const uint32_t *a, const uint32_t *b, size_t len) {
+	size_t i = 0;
+#if defined(USE_SSE2)
+	for (; i + 4 <= len; i += 4) {
+		__m128i eq = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)(a + i)),
+		                             _mm_loadu_si128((const __m128i *)(b + i)));
+		int mask = _mm_movemask_epi8(eq) ^ 0xFFFF;
+		if (mask) return i + (FIRST_LANE(mask) >> 2);
+	}
+#endif
+	for (; i < len && a[i] == b[i]; i++);
+	return i;
+}
+size_t mismatch_uint8(const uint8_t *a, const uint8_t *b, size_t len) {
+	size_t i = 0;
+#if defined(USE_SSE2)
+	for (; i + 16 <= len; i += 16) {
+		__m128i eq = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)(a + i)),
+		                            _mm_loadu_si128((const __m128i *)(b + i)));
+		int mask = _mm_movemask_epi8(eq) ^ 0xFFFF;
+		if (mask) return i + FIRST_LANE(mask);
+	}
+#endif
+	for (; i < len && a[i] == b[i]; i++);
+	return i;
+}
+/* Same, but comparing a 32 bit grapheme buffer against an 8 bit one, which
+ * is decoded as MVM_grapheme8_to_32 does: bytes 0x80..0x9F are the synthetics
+ * -1..-32, and the rest are Latin-1. */
+size_t mismatch_uint32_grapheme8(const uint32_t *a, const uint8_t *b, size_t len) {
+	size_t i = 0;
+#if defined(USE_SSE2)
+	const __m128i zero  = _mm_setzero_si128(),
+	              c1_lo = _mm_set1_epi32(0x7F),
+	              c1_hi = _mm_set1_epi32(0xA0);
+	for (; i + 16 <= len; i += 16) {
+		__m128i b8 = _mm_loadu_si128((const __m128i *)(b + i));
+		__m128i b16[2], b32[4];
+		int j;
+		b16[0] = _mm_unpacklo_epi8(b8, zero);
+		b16[1] = _mm_unpackhi_epi8(b8, zero);
+		for (j = 0; j < 2; j++) {
+			b32[2*j]     = _mm_unpacklo_epi16(b16[j], zero);
+			b32[2*j + 1] = _mm_unpackhi_epi16(b16[j], zero);
+		}
+		for (j = 0; j < 4; j++) {
+			__m128i synth = _mm_and_si128(_mm_cmpgt_epi32(b32[j], c1_lo),
+			                              _mm_cmpgt_epi32(c1_hi, b32[j]));
+			__m128i g = _mm_or_si128(
+				_mm_and_si128(synth, _mm_sub_epi32(c1_lo, b32[j])),
+				_mm_andnot_si128(synth, b32[j]));
+			__m128i eq = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)(a + i + 4*j)), g);
+			int mask = _mm_movemask_epi8(eq) ^ 0xFFFF;
+			if (mask) return i + 4*j + (FIRST_LANE(mask) >> 2);
+		}
+	}
+#endif
+	for (; i < len; i++) {
+		uint32_t g = (uint8_t)(b[i] - 0x80) < 0x20 ? (uint32_t)(0x7F - (int32_t)b[i]) : b[i];
+		if (a[i] != g)
+			break;
+	}
+	return i;
+}
+
+/* Returns the index of the first byte that lies within [lo, hi], equals
+ * extra, or is not ASCII (so may be a synthetic or Latin-1), or len if there
+ * is none. This lets character class searches skip over runs of uninteresting
+ * ASCII; the caller still does the exact check on whatever we stop at. */
+size_t find_uint8_in_range(const uint8_t *h, size_t len, uint8_t lo, uint8_t hi, uint8_t extra) {
+	size_t i = 0;
+#if defined(USE_SSE2)
+	const __m128i below = _mm_set1_epi8((char)(lo - 1)),
+	              above = _mm_set1_epi8((char)(hi + 1)),
+	              other = _mm_set1_epi8((char)extra);
+	for (; i + 16 <= len; i += 16) {
+		/* Bytes >= 0x80 compare as negative, so are never in range, but
+		 * are picked up by the movemask anyway. */
+		__m128i v   = _mm_loadu_si128((const __m128i *)(h + i));
+		__m128i hit = _mm_or_si128(
+			_mm_and_si128(_mm_cmpgt_epi8(v, below), _mm_cmpgt_epi8(above, v)),
+			_mm_or_si128(_mm_cmpeq_epi8(v, other), v));
+		int mask = _mm_movemask_epi8(hit);
+		if (mask) return i + FIRST_LANE(mask);
+	}
+#endif
+	for (; i < len; i++)
+		if ((lo <= h[i] && h[i] <= hi) || h[i] == extra || h[i] >= 0x80)
+			return i;
+	return i;
+}
+
+/* Returns the index of the first byte that is in the given set, or len if
+ * there is none. The set is laid out for lookup by nibbles: set[lo] has bit
+ * hi set if byte (hi << 4 | lo) is a member, for hi < 8, and set[16 + lo]
+ * does the same for hi - 8. That way, with SSSE3, a pair of shuffles does the
+ * lookup for 16 bytes at a time. */
+size_t find_uint8_in_set(const uint8_t *h, size_t len, const uint8_t set[32]) {
+	size_t i = 0;
+#if defined(USE_SSSE3)
+	const __m128i set_lo = _mm_loadu_si128((const __m128i *)set),
+	              set_hi = _mm_loadu_si128((const __m128i *)(set + 16)),
+	              bits   = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128,
+	                                     1, 2, 4, 8, 16, 32, 64, -128),
+	              nibble = _mm_set1_epi8(0x0F),
+	              seven  = _mm_set1_epi8(7);
+	for (; i + 16 <= len; i += 16) {
+		__m128i v     = _mm_loadu_si128((const __m128i *)(h + i));
+		__m128i lo    = _mm_and_si128(v, nibble);
+		__m128i hi    = _mm_and_si128(_mm_srli_epi16(v, 4), nibble);
+		__m128i upper = _mm_cmpgt_epi8(hi, seven);
+		__m128i row   = _mm_or_si128(
+			_mm_andnot_si128(upper, _mm_shuffle_epi8(set_lo, lo)),
+			_mm_and_si128(upper, _mm_shuffle_epi8(set_hi, lo)));
+		__m128i bit   = _mm_shuffle_epi8(bits, hi);
+		int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(row, bit), bit));
+		if (mask) return i + FIRST_LANE(mask);
+	}
+#endif
+	for (; i < len; i++)
+		if (set[(h[i] & 0x0F) | ((h[i] & 0x80) >> 3)] & (1 << ((h[i] >> 4) & 7)))
+			return i;
+	return i;
+}
+
+/* Returns the index of the first element that is either a or b, or len if
+ * there is none. Used to look for line separators, where the default set is
+ * two single graphemes (\n and the \r\n synthetic). */
+size_t find_uint32_either(const uint32_t *h, size_t len, uint32_t a, uint32_t b) {
+	size_t i = 0;
+#if defined(USE_SSE2)
+	const __m128i va = _mm_set1_epi32((int)a),
+	              vb = _mm_set1_epi32((int)b);
+	for (; i + 4 <= len; i += 4) {
+		__m128i v   = _mm_loadu_si128((const __m128i *)(h + i));
+		__m128i hit = _mm_or_si128(_mm_cmpeq_epi32(v, va), _mm_cmpeq_epi32(v, vb));
+		int mask = _mm_movemask_epi8(hit);
+		if (mask) return i + (FIRST_LANE(mask) >> 2);
+	}
+#endif
+	for (; i < len; i++)
+		if (h[i] == a || h[i] == b)
+			return i;
+	return i;
+}
@@ -1 +1,9 @@
+#include <stddef.h>
+#include <stdint.h>
 void *memmem_uint32(const void *h0, size_t k, const void *n0, size_t l);
+size_t mismatch_uint32(const uint32_t *a, const uint32_t *b, size_t len);
+size_t mismatch_uint8(const uint8_t *a, const uint8_t *b, size_t len);
+size_t mismatch_uint32_grapheme8(const uint32_t *a, const uint8_t *b, size_t len);
+size_t find_uint8_in_range(const uint8_t *h, size_t len, uint8_t lo, uint8_t hi, uint8_t extra);
+size_t find_uint8_in_set(const uint8_t *h, size_t len, const uint8_t set[32]);
+size_t find_uint32_either(const uint32_t *h, size_t len, uint32_t a, uint32_t b);
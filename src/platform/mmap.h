@@ -1,3 +1,5 @@
+#include <stdint.h>
+
 #define MVM_PAGE_READ    1
 #define MVM_PAGE_WRITE   2
 #define MVM_PAGE_EXEC    4
@@ -7,3 +9,5 @@ int MVM_platform_set_page_mode(void * block, size_t size, int mode);
 int MVM_platform_free_pages(void *block, size_t size);
 void *MVM_platform_map_file(int fd, void **handle, size_t size, int writable);
 int MVM_platform_unmap_file(void *block, void *handle, size_t size);
+size_t MVM_platform_map_granularity(void);
+void *MVM_platform_map_file_private(int fd, uint64_t offset, size_t size);
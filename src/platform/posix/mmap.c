@@ -1,5 +1,6 @@
 #include <stddef.h>
 #include <sys/mman.h>
+#include <unistd.h>
 #include "moar.h"
 #include "platform/mmap.h"
 #include <errno.h>
@@ -75,3 +76,18 @@ int MVM_platform_unmap_file(void *block, void *handle, size_t size)
     (void)handle;
     return munmap(block, size) == 0;
 }
+
+/* The boundary that the offset of a file mapping must be a multiple of. */
+size_t MVM_platform_map_granularity(void)
+{
+    return (size_t)sysconf(_SC_PAGESIZE);
+}
+
+/* Maps part of a file copy-on-write: the memory can be written to, but the
+ * changes are private to the mapping and never reach the file. */
+void *MVM_platform_map_file_private(int fd, uint64_t offset, size_t size)
+{
+    void *block = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE,
+        fd, (off_t)offset);
+    return block != MAP_FAILED ? block : NULL;
+}
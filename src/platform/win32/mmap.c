@@ -79,3 +79,32 @@ int MVM_platform_unmap_file(void *block, void *handle, size_t size) {
     (void)size;
     return unmapped && closed;
 }
+
+size_t MVM_platform_map_granularity(void) {
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwAllocationGranularity;
+}
+
+void *MVM_platform_map_file_private(int fd, uint64_t offset, size_t size) {
+    HANDLE fh, mapping;
+    ULARGE_INTEGER li;
+    void *block;
+
+    fh = (HANDLE)_get_osfhandle(fd);
+    if (fh == INVALID_HANDLE_VALUE)
+        return NULL;
+
+    mapping = CreateFileMapping(fh, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+    if (mapping == NULL)
+        return NULL;
+
+    li.QuadPart = offset;
+    block = MapViewOfFile(mapping, FILE_MAP_COPY, li.HighPart, li.LowPart, size);
+
+    /* The view keeps the mapping object alive, so we need not hold on to it
+     * (and the view can be unmapped without it). */
+    CloseHandle(mapping);
+
+    return block;
+}
@@ -1,4 +1,5 @@
 #include "moar.h"
+#include "platform/memmem32.h"
 
 /* A decode stream represents an on-going decoding process, from bytes into
  * characters. Bytes can be contributed to the decode stream, and chars can be
@@ -212,6 +213,7 @@ static MVMString * take_chars(MVMThreadContext *tc, MVMDecodeStream *ds, MVMint3
     MVMint32   result_chars = chars - exclude;
     if (result_chars < 0)
         MVM_exception_throw_adhoc(tc, "DecodeStream take_chars: chars - exclude < 0 should never happen, got (%"PRId32")", result_chars);
+    ds->sep_scan_chars = NULL;
 
     result                       = (MVMString *)MVM_repr_alloc_init(tc, tc->instance->VMString);
     result->body.storage_type    = MVM_STRING_GRAPHEME_32;
@@ -330,20 +332,40 @@ static MVMint32 have_separator(MVMThreadContext *tc, MVMDecodeStreamChars *start
     }
     return 0;
 }
-static MVMint32 find_separator(MVMThreadContext *tc, const MVMDecodeStream *ds,
+static MVMint32 find_separator(MVMThreadContext *tc, MVMDecodeStream *ds,
                                MVMDecodeStreamSeparators *sep_spec, MVMint32 *sep_length,
                                int eof) {
     MVMint32 sep_loc = 0;
     MVMDecodeStreamChars *cur_chars = ds->chars_head;
+    MVMint32 max_sep_length = sep_spec->max_sep_length;
+
+    /* With one or two separators of a single grapheme each, which includes
+     * the default of \n and \r\n, we can search for them directly rather
+     * than trying each separator in turn at each position. */
+    MVMint32 single_graphemes = max_sep_length == 1
+        && (sep_spec->num_seps == 1 || sep_spec->num_seps == 2)
+        && sep_spec->sep_lengths[0] == 1
+        && sep_spec->sep_lengths[sep_spec->num_seps - 1] == 1;
+
+    /* If an earlier search found nothing and no chars were taken since, the
+     * buffers it skipped need not be walked again. */
+    if (ds->sep_scan_chars && ds->sep_scan_max_length == max_sep_length) {
+        cur_chars = ds->sep_scan_chars;
+        sep_loc   = ds->sep_scan_loc;
+    }
 
     /* First, skip over any buffers we need not consider. */
-    MVMint32 max_sep_length = sep_spec->max_sep_length;
     while (cur_chars && cur_chars->next) {
         if (cur_chars->next->length < max_sep_length)
             break;
-        sep_loc += cur_chars->length;
+        sep_loc += cur_chars == ds->chars_head
+            ? cur_chars->length - ds->chars_head_pos
+            : cur_chars->length;
         cur_chars = cur_chars->next;
     }
+    ds->sep_scan_chars      = cur_chars;
+    ds->sep_scan_loc        = sep_loc;
+    ds->sep_scan_max_length = max_sep_length;
 
     /* Now scan for the separator. */
     while (cur_chars) {
@@ -367,6 +389,20 @@ static MVMint32 find_separator(MVMThreadContext *tc, const MVMDecodeStream *ds,
                     start = 0;
             }
         }
+        if (single_graphemes) {
+            MVMGrapheme32 first = sep_spec->sep_graphemes[0];
+            MVMGrapheme32 last  = sep_spec->sep_graphemes[sep_spec->num_seps - 1];
+            MVMint32 found = (MVMint32)find_uint32_either(
+                (const uint32_t *)cur_chars->chars + start, cur_chars->length - start,
+                (uint32_t)first, (uint32_t)last);
+            if (start + found < cur_chars->length) {
+                *sep_length = 1;
+                return sep_loc + found + 1;
+            }
+            sep_loc += cur_chars->length - start;
+            cur_chars = cur_chars->next;
+            continue;
+        }
         for (i = start; i < cur_chars->length; i++) {
             MVMint32 sep_graph_pos = 0;
             MVMGrapheme32 cur_char = cur_chars->chars[i];
@@ -444,6 +480,7 @@ MVMString * MVM_string_decodestream_get_until_sep_eof(MVMThreadContext *tc, MVMD
 static MVMString * get_all_in_buffer(MVMThreadContext *tc, MVMDecodeStream *ds) {
     MVMString *result = (MVMString *)MVM_repr_alloc_init(tc, tc->instance->VMString);
     result->body.storage_type = MVM_STRING_GRAPHEME_32;
+    ds->sep_scan_chars = NULL;
 
     /* If there's no codepoint buffer, then return the empty string. */
     if (!ds->chars_head) {
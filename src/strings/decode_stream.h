@@ -24,6 +24,14 @@ struct MVMDecodeStream {
     /* How far we've eaten into the current head char buffer. */
     MVMint32 chars_head_pos;
 
+    /* Where a separator search that found nothing got to, so the next one
+     * can carry on from there: the char buffer, the number of chars before
+     * it, and the maximum separator length it went by. Cleared whenever chars
+     * are taken. */
+    MVMDecodeStreamChars *sep_scan_chars;
+    MVMint32 sep_scan_loc;
+    MVMint32 sep_scan_max_length;
+
     /* The encoding we're using. */
     MVMint32 encoding;
 
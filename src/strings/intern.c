@@ -0,0 +1,92 @@
+#include "moar.h"
+
+/* Interning of strings. When enabled (by setting MVM_STRING_INTERN in the
+ * environment), strings from compilation unit and serialization string heaps,
+ * as well as short strings taken from decoders (so lines and chunks read from
+ * I/O handles), are looked up in a global table, and the first string seen
+ * with some contents is used in place of all others. This saves memory when
+ * the same names turn up in many places, and lets equality checks between two
+ * interned strings compare only their addresses.
+ *
+ * Interning isn't free: each string is hashed and looked up under a global
+ * lock, and the first string seen with some contents is copied into gen2 if
+ * it is a strand or in the nursery. So it is only applied to these sources,
+ * which are expected to repeat, and decoded strings are only interned when
+ * short.
+ *
+ * The table is weak: it is not a GC root, and an interned string removes
+ * itself from it when it is freed. Interned strings always live in gen2 and
+ * are never strands, so that the table needn't be updated as objects move
+ * and lookups never need to allocate.
+ *
+ * MVM_STRING_FLAG_INTERNED is only ever set here, on the one string in the
+ * table with its contents, so no two strings with the flag are equal. */
+
+/* Looks up a string in the table, returning the interned one if any. */
+static MVMString * lookup(MVMThreadContext *tc, MVMString *s) {
+    struct MVMStringInternEntry *entry;
+    MVMString *result;
+    uv_mutex_lock(&tc->instance->mutex_string_interns);
+    entry  = MVM_str_hash_fetch_nocheck(tc, &tc->instance->string_interns, s);
+    result = entry ? entry->hash_handle.key : NULL;
+    uv_mutex_unlock(&tc->instance->mutex_string_interns);
+    return result;
+}
+
+/* Returns the interned string with the same contents as the one passed, which
+ * may be the same string. If interning is disabled, returns the string. */
+MVMString * MVM_string_intern(MVMThreadContext *tc, MVMString *s) {
+    struct MVMStringInternEntry *entry;
+    MVMString *result;
+
+    if (!tc->instance->string_interning || !s || !IS_CONCRETE(s) || MVM_string_is_interned(s))
+        return s;
+    if ((result = lookup(tc, s)))
+        return result;
+
+    /* Not seen yet. Make the string we'll intern, which must be flat and in
+     * gen2; allocating in gen2 never triggers GC, so nothing needs rooting. */
+    if (s->body.storage_type == MVM_STRING_STRAND || !(s->common.header.flags2 & MVM_CF_SECOND_GEN)) {
+        MVM_gc_allocate_gen2_default_set(tc);
+        s = s->body.storage_type == MVM_STRING_STRAND
+            ? MVM_string_indexing_optimized(tc, s)
+            : (MVMString *)MVM_repr_clone(tc, (MVMObject *)s);
+        MVM_gc_allocate_gen2_default_clear(tc);
+    }
+
+    /* Add it, unless another thread beat us to it. */
+    uv_mutex_lock(&tc->instance->mutex_string_interns);
+    entry = MVM_str_hash_lvalue_fetch_nocheck(tc, &tc->instance->string_interns, s);
+    if (!entry->hash_handle.key) {
+        s->body.flags |= MVM_STRING_FLAG_INTERNED;
+        entry->hash_handle.key = s;
+    }
+    result = entry->hash_handle.key;
+    uv_mutex_unlock(&tc->instance->mutex_string_interns);
+    return result;
+}
+
+/* Interns a string taken from a decoder, if it is short enough that the
+ * same contents are likely to turn up again. */
+MVMString * MVM_string_intern_decoded(MVMThreadContext *tc, MVMString *s) {
+    if (!tc->instance->string_interning || !s
+            || MVM_string_graphs_nocheck(tc, s) > MVM_STRING_INTERN_DECODED_MAX_GRAPHS)
+        return s;
+    return MVM_string_intern(tc, s);
+}
+
+/* Called when an interned string is freed, to remove it from the table. The
+ * entry for its contents must be the string itself; anything else means a
+ * second string with the same contents carries the interned flag, and address
+ * comparisons of interned strings can no longer be trusted. */
+void MVM_string_intern_forget(MVMThreadContext *tc, MVMString *s) {
+    struct MVMStringInternEntry *entry;
+    uv_mutex_lock(&tc->instance->mutex_string_interns);
+    entry = MVM_str_hash_fetch_nocheck(tc, &tc->instance->string_interns, s);
+    if (!entry || entry->hash_handle.key != s) {
+        uv_mutex_unlock(&tc->instance->mutex_string_interns);
+        MVM_oops(tc, "Interned string being freed is not the one in the intern table");
+    }
+    MVM_str_hash_delete_nocheck(tc, &tc->instance->string_interns, s);
+    uv_mutex_unlock(&tc->instance->mutex_string_interns);
+}
@@ -0,0 +1,20 @@
+/* An entry in the table of interned strings. */
+struct MVMStringInternEntry {
+    struct MVMStrHashHandle hash_handle;
+};
+
+/* Decoded strings longer than this are not interned. */
+#define MVM_STRING_INTERN_DECODED_MAX_GRAPHS 64
+
+MVMString * MVM_string_intern(MVMThreadContext *tc, MVMString *s);
+MVMString * MVM_string_intern_decoded(MVMThreadContext *tc, MVMString *s);
+void MVM_string_intern_forget(MVMThreadContext *tc, MVMString *s);
+
+/* Is the string interned? If two different strings both are, they must have
+ * different contents, so they can be compared by address alone. */
+MVM_STATIC_INLINE int MVM_string_is_interned(MVMString *s) {
+    return s->body.flags & MVM_STRING_FLAG_INTERNED;
+}
+MVM_STATIC_INLINE int MVM_string_both_interned(MVMString *a, MVMString *b) {
+    return a->body.flags & b->body.flags & MVM_STRING_FLAG_INTERNED;
+}
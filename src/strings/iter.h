@@ -1,12 +1,9 @@
 /* Grapheme iterator structure; iterates through graphemes in a string. */
 struct MVMGraphemeIter {
-    /* The blob we're currently iterating over. */
-    union {
-        MVMGrapheme32    *blob_32;
-        MVMGraphemeASCII *blob_ascii;
-        MVMGrapheme8     *blob_8;
-        void             *any;
-    } active_blob;
+    /* The blob we're currently iterating over. This is a copy of the string's
+     * storage, so that graphemes stored in situ are copied along with it and
+     * stay valid even if the string is moved by GC. */
+    MVMStringStorage active_blob;
 
     /* The type of blob we have. */
     MVMuint16 blob_type;
@@ -32,7 +29,7 @@ MVM_STATIC_INLINE void MVM_string_gi_init(MVMThreadContext *tc, MVMGraphemeIter
     if (s->body.storage_type == MVM_STRING_STRAND) {
         MVMStringStrand *strands = s->body.storage.strands;
         MVMString       *first   = strands[0].blob_string;
-        gi->active_blob.any      = first->body.storage.any;
+        gi->active_blob          = first->body.storage;
         gi->blob_type            = first->body.storage_type;
         gi->strands_remaining    = s->body.num_strands - 1;
         gi->pos = gi->start      = strands[0].start;
@@ -41,7 +38,7 @@ MVM_STATIC_INLINE void MVM_string_gi_init(MVMThreadContext *tc, MVMGraphemeIter
         gi->next_strand          = strands + 1;
     }
     else {
-        gi->active_blob.any   = s->body.storage.any;
+        gi->active_blob       = s->body.storage;
         gi->blob_type         = s->body.storage_type;
         gi->end               = s->body.num_graphs;
         gi->strands_remaining = gi->start = gi->pos = gi->repetitions = 0;
@@ -70,7 +67,7 @@ static void MVM_string_gi_next_strand_rep(MVMThreadContext *tc, MVMGraphemeIter
     gi->end             = next->end;
     gi->repetitions     = next->repetitions;
     gi->blob_type       = next->blob_string->body.storage_type;
-    gi->active_blob.any = next->blob_string->body.storage.any;
+    gi->active_blob     = next->blob_string->body.storage;
     gi->strands_remaining--;
 }
 /* Sets the position of the iterator. (Can be optimized in many ways in the
@@ -93,7 +90,7 @@ MVM_STATIC_INLINE void MVM_string_gi_move_to(MVMThreadContext *tc, MVMGraphemeIt
     }
     if (next) {
         gi->blob_type       = next->blob_string->body.storage_type;
-        gi->active_blob.any = next->blob_string->body.storage.any;
+        gi->active_blob     = next->blob_string->body.storage;
     }
 
     /* Now look within the strand. */
@@ -131,6 +128,48 @@ MVM_STATIC_INLINE void MVM_string_gi_move_to(MVMThreadContext *tc, MVMGraphemeIt
     MVM_exception_throw_adhoc(tc, "Iteration past end of grapheme iterator");
 }
 
+/* Gets the index of the grapheme offset each strand of a strand string starts
+ * at, building it first if needed. */
+MVMStringIndex * MVM_string_build_strand_index(MVMThreadContext *tc, MVMString *s);
+MVM_STATIC_INLINE MVMStringIndex * MVM_string_strand_index(MVMThreadContext *tc, MVMString *s) {
+    return s->body.flags & MVM_STRING_FLAG_STRAND_INDEX
+        ? (MVMStringIndex *)(s->body.storage.strands + s->body.num_strands)
+        : MVM_string_build_strand_index(tc, s);
+}
+
+/* Initializes a grapheme iterator positioned at the given grapheme. For a
+ * string of many strands, we binary search the strand index for the strand
+ * to start in rather than walking the strands from the first. */
+MVM_STATIC_INLINE void MVM_string_gi_init_at(MVMThreadContext *tc, MVMGraphemeIter *gi, MVMString *s, MVMuint32 pos) {
+    if (pos && s->body.storage_type == MVM_STRING_STRAND && s->body.num_strands > 2) {
+        MVMStringIndex  *offsets = MVM_string_strand_index(tc, s);
+        MVMStringStrand *strand;
+        MVMuint16 lo = 0, hi = s->body.num_strands - 1;
+        /* Find the last strand starting at or before pos. */
+        while (lo < hi) {
+            MVMuint16 mid = (lo + hi + 1) / 2;
+            if (offsets[mid] <= pos)
+                lo = mid;
+            else
+                hi = mid - 1;
+        }
+        strand                = s->body.storage.strands + lo;
+        gi->active_blob       = strand->blob_string->body.storage;
+        gi->blob_type         = strand->blob_string->body.storage_type;
+        gi->strands_remaining = s->body.num_strands - 1 - lo;
+        gi->pos = gi->start   = strand->start;
+        gi->end               = strand->end;
+        gi->repetitions       = strand->repetitions;
+        gi->next_strand       = strand + 1;
+        pos                  -= offsets[lo];
+    }
+    else {
+        MVM_string_gi_init(tc, gi, s);
+    }
+    if (pos)
+        MVM_string_gi_move_to(tc, gi, pos);
+}
+
 /* Checks if there is more to read from a grapheme iterator. */
 MVM_STATIC_INLINE MVMint32 MVM_string_gi_has_more(MVMThreadContext *tc, MVMGraphemeIter *gi) {
     return gi->pos < gi->end || gi->repetitions || gi->strands_remaining;
@@ -140,7 +179,9 @@ MVM_STATIC_INLINE MVMStringIndex MVM_string_gi_graphs_left_in_strand(MVMThreadCo
     return gi->end - gi->pos;
 }
 MVM_STATIC_INLINE MVMGrapheme8 * MVM_string_gi_active_blob_8_pos(MVMThreadContext *tc, MVMGraphemeIter *gi) {
-    return gi->active_blob.blob_8 + gi->pos;
+    return (gi->blob_type == MVM_STRING_IN_SITU_8
+        ? gi->active_blob.in_situ_8
+        : gi->active_blob.blob_8) + gi->pos;
 }
 MVM_STATIC_INLINE MVMGrapheme32 * MVM_string_gi_active_blob_32_pos(MVMThreadContext *tc, MVMGraphemeIter *gi) {
     return gi->active_blob.blob_32 + gi->pos;
@@ -162,7 +203,9 @@ MVM_STATIC_INLINE MVMGrapheme32 MVM_string_gi_get_grapheme(MVMThreadContext *tc,
                 case MVM_STRING_GRAPHEME_ASCII:
                     return gi->active_blob.blob_ascii[gi->pos++];
                 case MVM_STRING_GRAPHEME_8:
-                    return gi->active_blob.blob_8[gi->pos++];
+                    return MVM_grapheme8_to_32(gi->active_blob.blob_8[gi->pos++]);
+                case MVM_STRING_IN_SITU_8:
+                    return MVM_grapheme8_to_32(gi->active_blob.in_situ_8[gi->pos++]);
                 }
         }
         else if (gi->repetitions) {
@@ -171,7 +214,7 @@ MVM_STATIC_INLINE MVMGrapheme32 MVM_string_gi_get_grapheme(MVMThreadContext *tc,
         }
         else if (gi->strands_remaining) {
             MVMStringStrand *next = gi->next_strand;
-            gi->active_blob.any = next->blob_string->body.storage.any;
+            gi->active_blob     = next->blob_string->body.storage;
             gi->blob_type       = next->blob_string->body.storage_type;
             gi->pos             = next->start;
             gi->end             = next->end;
@@ -195,11 +238,12 @@ MVM_STATIC_INLINE MVMGrapheme32 MVM_string_get_grapheme_at_nocheck(MVMThreadCont
         case MVM_STRING_GRAPHEME_ASCII:
             return a->body.storage.blob_ascii[index];
         case MVM_STRING_GRAPHEME_8:
-            return a->body.storage.blob_8[index];
+            return MVM_grapheme8_to_32(a->body.storage.blob_8[index]);
+        case MVM_STRING_IN_SITU_8:
+            return MVM_grapheme8_to_32(a->body.storage.in_situ_8[index]);
         case MVM_STRING_STRAND: {
             MVMGraphemeIter gi;
-            MVM_string_gi_init(tc, &gi, a);
-            MVM_string_gi_move_to(tc, &gi, index);
+            MVM_string_gi_init_at(tc, &gi, a, index);
             return MVM_string_gi_get_grapheme(tc, &gi);
         }
         default:
@@ -352,8 +396,7 @@ struct MVMGraphemeIter_cached {
 };
 typedef struct MVMGraphemeIter_cached MVMGraphemeIter_cached;
 MVM_STATIC_INLINE void MVM_string_gi_cached_init (MVMThreadContext *tc, MVMGraphemeIter_cached *gic, MVMString *s, MVMint64 index) {
-    MVM_string_gi_init(tc, &(gic->gi), s);
-    if (index) MVM_string_gi_move_to(tc, &(gic->gi), index);
+    MVM_string_gi_init_at(tc, &(gic->gi), s, index);
     gic->last_location = index;
     gic->last_g = MVM_string_gi_get_grapheme(tc, &(gic->gi));
     gic->string = s;
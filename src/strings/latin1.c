@@ -10,36 +10,54 @@ MVMString * MVM_string_latin1_decode(MVMThreadContext *tc, const MVMObject *resu
     size_t i, k, result_graphs;
 
     MVMuint8 writing_32bit = 0;
-
-    result->body.storage_type   = MVM_STRING_GRAPHEME_8;
-    result->body.storage.blob_8 = MVM_malloc(sizeof(MVMint8) * bytes);
+    MVMGrapheme32 crlf = MVM_nfg_crlf_grapheme(tc);
+    MVMGrapheme8 *blob_8;
+
+    /* Short strings go in situ; nothing from here on allocates a GC object,
+     * so it's safe to hold a pointer into the result. */
+    if (bytes <= MVM_STRING_IN_SITU_8_MAX) {
+        result->body.storage_type = MVM_STRING_IN_SITU_8;
+        blob_8 = result->body.storage.in_situ_8;
+    }
+    else {
+        result->body.storage_type = MVM_STRING_GRAPHEME_8;
+        blob_8 = result->body.storage.blob_8 = MVM_malloc(sizeof(MVMGrapheme8) * bytes);
+    }
 
     result_graphs = 0;
     for (i = 0; i < bytes; i++) {
+        MVMGrapheme32 g;
         if (latin1[i] == '\r' && i + 1 < bytes && latin1[i + 1] == '\n') {
-            if (writing_32bit)
-                result->body.storage.blob_32[result_graphs++] = MVM_nfg_crlf_grapheme(tc);
-            else
-                result->body.storage.blob_8[result_graphs++] = MVM_nfg_crlf_grapheme(tc);
+            g = crlf;
             i++;
         }
         else {
-            if (latin1[i] > 127 && !writing_32bit) {
-                MVMGrapheme8 *old_storage = result->body.storage.blob_8;
-
-                result->body.storage.blob_32 = MVM_malloc(sizeof(MVMGrapheme32) * bytes);
-                result->body.storage_type = MVM_STRING_GRAPHEME_32;
-                writing_32bit = 1;
+            g = latin1[i];
+        }
+        /* Everything but the C1 controls (and any synthetic that is out of
+         * range) fits into 8-bit storage; if not, switch to 32-bit. */
+        if (!writing_32bit && !MVM_grapheme32_can_fit_into_8bit(g)) {
+            MVMGrapheme8   old_in_situ[MVM_STRING_IN_SITU_8_MAX];
+            MVMGrapheme8  *old_storage = blob_8;
+            MVMGrapheme32 *blob_32     = MVM_malloc(sizeof(MVMGrapheme32) * bytes);
+
+            if (result->body.storage_type == MVM_STRING_IN_SITU_8) {
+                memcpy(old_in_situ, blob_8, result_graphs);
+                old_storage = old_in_situ;
+            }
+            result->body.storage.blob_32 = blob_32;
+            result->body.storage_type = MVM_STRING_GRAPHEME_32;
+            writing_32bit = 1;
 
-                for (k = 0; k < i; k++)
-                    result->body.storage.blob_32[k] = old_storage[k];
+            for (k = 0; k < result_graphs; k++)
+                blob_32[k] = MVM_grapheme8_to_32(old_storage[k]);
+            if (old_storage != old_in_situ)
                 MVM_free(old_storage);
-            }
-            if (writing_32bit)
-                result->body.storage.blob_32[result_graphs++] = latin1[i];
-            else
-                result->body.storage.blob_8[result_graphs++] = latin1[i];
         }
+        if (writing_32bit)
+            result->body.storage.blob_32[result_graphs++] = g;
+        else
+            blob_8[result_graphs++] = MVM_grapheme32_to_8(g);
     }
     result->body.num_graphs = result_graphs;
 
@@ -133,6 +151,16 @@ MVMuint32 MVM_string_latin1_decodestream(MVMThreadContext *tc, MVMDecodeStream *
     return reached_stopper;
 }
 
+/* Checks if a buffer of 8-bit graphemes holds any synthetics (which live in
+ * the C1 control range), and so can't just be copied out as Latin-1. */
+static int latin1_blob_has_synthetics(MVMGrapheme8 *blob, MVMuint32 length) {
+    MVMuint32 i;
+    for (i = 0; i < length; i++)
+        if ((MVMuint8)(blob[i] - 0x80) < MVM_GRAPHEME8_NUM_SYNTHS)
+            return 1;
+    return 0;
+}
+
 /* Encodes the specified substring to latin-1. Anything outside of latin-1 range
  * will become a ?. The result string is NULL terminated, but the specified
  * size is the non-null part. */
@@ -166,6 +194,15 @@ char * MVM_string_latin1_encode_substr(MVMThreadContext *tc, MVMString *str, MVM
         if (output_size)
             *output_size = lengthu;
     }
+    else if ((str->body.storage_type == MVM_STRING_GRAPHEME_8
+                || str->body.storage_type == MVM_STRING_IN_SITU_8) && !translate_newlines
+            && !latin1_blob_has_synthetics(MVM_string_blob_8(str) + start, lengthu)) {
+        /* 8-bit storage is Latin-1 already, bar any synthetics. */
+        memcpy(result, MVM_string_blob_8(str) + start, lengthu);
+        result[lengthu] = 0;
+        if (output_size)
+            *output_size = lengthu;
+    }
     else {
         MVMuint32 i = 0;
         MVMCodepointIter ci;
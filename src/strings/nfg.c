@@ -5,14 +5,22 @@
 #define MVM_SYNTHETIC_GROW_ELEMS 32
 
 /* Finds the index of a given codepoint within a trie node. Returns it if
- * there is one, or negative if there is not (note 0 is a valid index). */
+ * there is one, or negative if there is not (note 0 is a valid index). The
+ * entries are sorted by codepoint, so we binary search them. */
 static MVMint32 find_child_node_idx(MVMThreadContext *tc, const MVMNFGTrieNode *node, MVMCodepoint cp) {
     if (node) {
-        /* TODO: update this to do a binary search later on. */
-        MVMint32 i;
-        for (i = 0; i < node->num_entries; i++)
-            if (node->next_codes[i].code == cp)
-                return i;
+        const MVMNFGTrieNodeEntry *next_codes = node->next_codes;
+        MVMint32 lo = 0;
+        MVMint32 hi = node->num_entries;
+        while (lo < hi) {
+            MVMint32 mid = lo + (hi - lo) / 2;
+            if (next_codes[mid].code < cp)
+                lo = mid + 1;
+            else if (next_codes[mid].code > cp)
+                hi = mid;
+            else
+                return mid;
+        }
     }
     return -1;
 }
@@ -23,7 +31,7 @@ MVMNFGTrieNode * find_child_node(MVMThreadContext *tc, const MVMNFGTrieNode *nod
     return idx >= 0 ? node->next_codes[idx].node : NULL;
 }
 static MVMGrapheme32 lookup_synthetic(MVMThreadContext *tc, MVMCodepoint *codes, MVMint32 num_codes) {
-    MVMNFGTrieNode *cur_node        = tc->instance->nfg->grapheme_lookup;
+    MVMNFGTrieNode *cur_node        = (MVMNFGTrieNode *)MVM_load(&(tc->instance->nfg->grapheme_lookup));
     MVMCodepoint   *cur_code        = codes;
     MVMint32        codes_remaining = num_codes;
     while (cur_node && codes_remaining) {
@@ -136,8 +144,7 @@ static MVMNFGTrieNode * twiddle_trie_node(MVMThreadContext *tc, MVMNFGTrieNode *
 static void add_synthetic_to_trie(MVMThreadContext *tc, MVMCodepoint *codes, MVMint32 num_codes, MVMGrapheme32 synthetic) {
     MVMNFGState    *nfg      = tc->instance->nfg;
     MVMNFGTrieNode *new_trie = twiddle_trie_node(tc, nfg->grapheme_lookup, codes, num_codes, synthetic);
-    MVM_barrier();
-    nfg->grapheme_lookup = new_trie;
+    MVM_store(&(nfg->grapheme_lookup), new_trie);
 }
 
 /* Assumes that we are holding the lock that serializes updates, and already
@@ -221,11 +228,31 @@ static MVMGrapheme32 add_synthetic(MVMThreadContext *tc, MVMCodepoint *codes, MV
     return result;
 }
 
-/* Does a lookup of a synthetic in the trie. If we find one, returns it. If
- * not, acquires the update lock, re-checks that we really are missing the
- * synthetic, and then adds it. */
+/* Picks the slot in the per-thread cache for a sequence of codepoints. */
+MVM_STATIC_INLINE MVMuint32 cache_slot(MVMCodepoint *codes, MVMint32 num_codes) {
+    MVMuint32 hash = num_codes;
+    MVMint32  i;
+    for (i = 0; i < num_codes; i++)
+        hash = (hash ^ (MVMuint32)codes[i]) * 0x9E3779B1;
+    return hash >> (32 - MVM_NFG_CACHE_BITS);
+}
+
+/* Looks for a synthetic in the per-thread cache, then in the trie. If we find
+ * one, returns it. If not, acquires the update lock, re-checks that we really
+ * are missing the synthetic, and then adds it. Only the adding is done under
+ * the lock; readers never take it. */
 static MVMGrapheme32 lookup_or_add_synthetic(MVMThreadContext *tc, MVMCodepoint *codes, MVMint32 num_codes, MVMint32 utf8_c8) {
-    MVMGrapheme32 result = lookup_synthetic(tc, codes, num_codes);
+    MVMNFGCacheEntry *entry;
+    MVMGrapheme32     result;
+
+    if (MVM_UNLIKELY(!tc->nfg_cache))
+        tc->nfg_cache = MVM_calloc(1 << MVM_NFG_CACHE_BITS, sizeof(MVMNFGCacheEntry));
+    entry = &(tc->nfg_cache[cache_slot(codes, num_codes)]);
+    if (entry->num_codes == num_codes
+            && memcmp(entry->codes, codes, num_codes * sizeof(MVMCodepoint)) == 0)
+        return entry->synth;
+
+    result = lookup_synthetic(tc, codes, num_codes);
     if (!result) {
         uv_mutex_lock(&tc->instance->nfg->update_mutex);
         result = lookup_synthetic(tc, codes, num_codes);
@@ -233,6 +260,10 @@ static MVMGrapheme32 lookup_or_add_synthetic(MVMThreadContext *tc, MVMCodepoint
             result = add_synthetic(tc, codes, num_codes, utf8_c8);
         uv_mutex_unlock(&tc->instance->nfg->update_mutex);
     }
+
+    entry->codes     = MVM_nfg_get_synthetic_info(tc, result)->codes;
+    entry->num_codes = num_codes;
+    entry->synth     = result;
     return result;
 }
 
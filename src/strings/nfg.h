@@ -76,6 +76,26 @@ struct MVMNFGTrieNodeEntry {
     MVMNFGTrieNode *node;
 };
 
+/* Each thread keeps a small cache of the synthetics it recently looked up,
+ * so that text using the same few over and over (emoji, Indic scripts) does
+ * not need to walk the shared trie each time. Synthetics are never removed,
+ * so entries never go stale. This is how many bits of the hash of the
+ * codepoints are used to pick a cache slot. */
+#define MVM_NFG_CACHE_BITS 6
+
+/* An entry in a thread's cache of recently used synthetics. */
+struct MVMNFGCacheEntry {
+    /* The codepoints of the synthetic; this points at those held in the
+     * synthetics table, which live as long as the instance. */
+    MVMCodepoint *codes;
+
+    /* The number of codepoints, or 0 if the entry is unused. */
+    MVMint32 num_codes;
+
+    /* The synthetic. */
+    MVMGrapheme32 synth;
+};
+
 /* The maximum number of codepoints we will allow in a synthetic grapheme.
  * This is a good bit higher than any real-world use case is going to run
  * in to. */
@@ -163,7 +163,25 @@ static MVMint64 knuth_morris_pratt_string_index (MVMThreadContext *tc, MVMString
 
 /* Allocates strand storage. */
 static MVMStringStrand * allocate_strands(MVMThreadContext *tc, MVMuint16 num_strands) {
-    return MVM_malloc(num_strands * sizeof(MVMStringStrand));
+    return MVM_malloc(MVM_STRING_STRANDS_SIZE(num_strands));
+}
+
+/* Fills in the index of the grapheme offset at which each strand starts. The
+ * strands never change once the string is made, so if two threads race to do
+ * this they write the same values; we just make sure the flag is only seen
+ * once the index is complete. */
+MVMStringIndex * MVM_string_build_strand_index(MVMThreadContext *tc, MVMString *s) {
+    MVMStringStrand *strands = s->body.storage.strands;
+    MVMStringIndex  *offsets = (MVMStringIndex *)(strands + s->body.num_strands);
+    MVMStringIndex   offset  = 0;
+    MVMuint16 i;
+    for (i = 0; i < s->body.num_strands; i++) {
+        offsets[i] = offset;
+        offset    += (strands[i].end - strands[i].start) * (strands[i].repetitions + 1);
+    }
+    MVM_barrier();
+    s->body.flags |= MVM_STRING_FLAG_STRAND_INDEX;
+    return offsets;
 }
 
 /* Copies strands from one strand string to another. */
@@ -187,7 +205,7 @@ static void move_strands(MVMThreadContext *tc, const MVMString *from, MVMuint16
         num_strands * sizeof(MVMStringStrand));
 }
 
-#define can_fit_into_8bit(g) ((-128 <= (g) && (g) <= 127))
+#define can_fit_into_8bit(g) MVM_grapheme32_can_fit_into_8bit(g)
 
 MVM_STATIC_INLINE int can_fit_into_ascii (MVMGrapheme32 g) {
     return 0 <= g && g <= 127;
@@ -199,11 +217,17 @@ static void turn_32bit_into_8bit_unchecked(MVMThreadContext *tc, MVMString *str)
     MVMStringIndex i;
     MVMGrapheme8 *dest_buf = NULL;
     MVMStringIndex num_graphs = MVM_string_graphs_nocheck(tc, str);
-    str->body.storage_type   = MVM_STRING_GRAPHEME_8;
-    dest_buf = str->body.storage.blob_8 = MVM_malloc(str->body.num_graphs * sizeof(MVMGrapheme8));
+    if (num_graphs <= MVM_STRING_IN_SITU_8_MAX) {
+        str->body.storage_type = MVM_STRING_IN_SITU_8;
+        dest_buf = str->body.storage.in_situ_8;
+    }
+    else {
+        str->body.storage_type = MVM_STRING_GRAPHEME_8;
+        dest_buf = str->body.storage.blob_8 = MVM_malloc(str->body.num_graphs * sizeof(MVMGrapheme8));
+    }
     MVM_VECTORIZE_LOOP
     for (i = 0; i < num_graphs; i++) {
-        dest_buf[i] = old_buf[i];
+        dest_buf[i] = MVM_grapheme32_to_8(old_buf[i]);
     }
 
     MVM_free(old_buf);
@@ -250,9 +274,15 @@ static void iterate_gi_into_string(MVMThreadContext *tc, MVMGraphemeIter *gi, MV
 
     if (string_can_be_8bit(tc, gi, result_graphs)) {
         MVMStringIndex result_pos = 0;
-        result->body.storage_type = MVM_STRING_GRAPHEME_8;
-        result8 = result->body.storage.blob_8 =
-            MVM_malloc(result_graphs * sizeof(MVMGrapheme8));
+        if (result_graphs <= MVM_STRING_IN_SITU_8_MAX) {
+            result->body.storage_type = MVM_STRING_IN_SITU_8;
+            result8 = result->body.storage.in_situ_8;
+        }
+        else {
+            result->body.storage_type = MVM_STRING_GRAPHEME_8;
+            result8 = result->body.storage.blob_8 =
+                MVM_malloc(result_graphs * sizeof(MVMGrapheme8));
+        }
         while (1) {
             MVMStringIndex strand_len =
                 MVM_string_gi_graphs_left_in_strand(tc, gi);
@@ -267,12 +297,13 @@ static void iterate_gi_into_string(MVMThreadContext *tc, MVMGraphemeIter *gi, MV
                     MVM_string_gi_active_blob_32_pos(tc, gi);
                 MVM_VECTORIZE_LOOP
                 for (i = 0; i < to_copy; i++) {
-                    result_blob8[i] = active_blob[i];
+                    result_blob8[i] = MVM_grapheme32_to_8(active_blob[i]);
                 }
                 break;
             }
             case MVM_STRING_GRAPHEME_8:
-            case MVM_STRING_GRAPHEME_ASCII: {
+            case MVM_STRING_GRAPHEME_ASCII:
+            case MVM_STRING_IN_SITU_8: {
                 memcpy(
                     result_blob8,
                     MVM_string_gi_active_blob_8_pos(tc, gi),
@@ -281,7 +312,8 @@ static void iterate_gi_into_string(MVMThreadContext *tc, MVMGraphemeIter *gi, MV
                 break;
             }
             default: {
-                MVM_free(result->body.storage.blob_8);
+                if (result->body.storage_type == MVM_STRING_GRAPHEME_8)
+                    MVM_free(result->body.storage.blob_8);
                 MVM_exception_throw_adhoc(tc,
                     "Internal error, string corruption in iterate_gi_into_string\n");
             }
@@ -305,14 +337,15 @@ static void iterate_gi_into_string(MVMThreadContext *tc, MVMGraphemeIter *gi, MV
                 : strand_len;
             switch (MVM_string_gi_blob_type(tc, gi)) {
                 case MVM_STRING_GRAPHEME_8:
-                case MVM_STRING_GRAPHEME_ASCII: {
+                case MVM_STRING_GRAPHEME_ASCII:
+                case MVM_STRING_IN_SITU_8: {
                     MVMGrapheme8  *active_blob =
                         MVM_string_gi_active_blob_8_pos(tc, gi);
                     MVMGrapheme32 *result_blob32 = result32 + result_pos;
                     MVMStringIndex i;
                     MVM_VECTORIZE_LOOP
                     for (i = 0; i < to_copy; i++) {
-                        result_blob32[i] = active_blob[i];
+                        result_blob32[i] = MVM_grapheme8_to_32(active_blob[i]);
                     }
                     break;
                 }
@@ -392,6 +425,10 @@ static MVMString * collapse_strands(MVMThreadContext *tc, MVMString *orig) {
                     break;
                 }
             }
+            /* Short results may fit in situ, which the iterator path handles
+             * (as it does strands that are themselves in situ). */
+            if (result->body.num_graphs <= MVM_STRING_IN_SITU_8_MAX)
+                common_storage_type = -1;
             result->body.storage_type = common_storage_type;
             switch (common_storage_type) {
                 case MVM_STRING_GRAPHEME_32:
@@ -416,6 +453,73 @@ static MVMString * collapse_strands(MVMThreadContext *tc, MVMString *orig) {
     return result;
 }
 
+/* Rebalances a strand string that has too many strands, by collapsing runs of
+ * neighbouring strands into flat strings. Rather than collapsing the whole
+ * thing, we keep the strands' sizes decreasing geometrically (each group is at
+ * least twice the size of the one after it), using a stack much like that of
+ * a merge sort: a new strand is merged with the group before it while that
+ * one is not at least twice its size. This leaves only a logarithmic number
+ * of strands, and since a grapheme is only copied again when the group it is
+ * in (at least) grows by half, building a string by repeated appends costs
+ * O(n log n) copying rather than O(n^2). */
+static MVMString * rebalance_strands(MVMThreadContext *tc, MVMString *orig) {
+    MVMuint16  group_start[MVM_STRING_MAX_STRANDS + 1];
+    MVMuint64  group_graphs[MVM_STRING_MAX_STRANDS];
+    MVMuint16  num_groups = 0, i, g;
+    MVMString *result = NULL, *piece = NULL;
+
+    if (orig->body.storage_type != MVM_STRING_STRAND || MVM_STRING_MAX_STRANDS < orig->body.num_strands)
+        return collapse_strands(tc, orig);
+
+    for (i = 0; i < orig->body.num_strands; i++) {
+        MVMStringStrand *strand = &(orig->body.storage.strands[i]);
+        group_start[num_groups]  = i;
+        group_graphs[num_groups] = (MVMuint64)(strand->end - strand->start) * (strand->repetitions + 1);
+        num_groups++;
+        while (1 < num_groups && group_graphs[num_groups - 2] < 2 * group_graphs[num_groups - 1]) {
+            group_graphs[num_groups - 2] += group_graphs[num_groups - 1];
+            num_groups--;
+        }
+    }
+    group_start[num_groups] = orig->body.num_strands;
+    if (num_groups == 1)
+        return collapse_strands(tc, orig);
+
+    MVMROOT3(tc, orig, result, piece, {
+        result = (MVMString *)MVM_repr_alloc_init(tc, tc->instance->VMString);
+        result->body.storage_type    = MVM_STRING_STRAND;
+        result->body.storage.strands = allocate_strands(tc, num_groups);
+        result->body.num_graphs      = orig->body.num_graphs;
+        /* Only count strands once they're filled in, since allocating the
+         * pieces may trigger GC. */
+        result->body.num_strands     = 0;
+        for (g = 0; g < num_groups; g++) {
+            MVMuint16        num_in_group = group_start[g + 1] - group_start[g];
+            MVMStringStrand *strand       = &(result->body.storage.strands[g]);
+            if (num_in_group == 1) {
+                *strand = orig->body.storage.strands[group_start[g]];
+            }
+            else {
+                piece = (MVMString *)MVM_repr_alloc_init(tc, tc->instance->VMString);
+                piece->body.storage_type    = MVM_STRING_STRAND;
+                piece->body.storage.strands = allocate_strands(tc, num_in_group);
+                piece->body.num_strands     = num_in_group;
+                piece->body.num_graphs      = (MVMStringIndex)group_graphs[g];
+                copy_strands(tc, orig, group_start[g], piece, 0, num_in_group);
+                piece = collapse_strands(tc, piece);
+                strand->blob_string = piece;
+                strand->start       = 0;
+                strand->end         = piece->body.num_graphs;
+                strand->repetitions = 0;
+            }
+            MVM_gc_write_barrier(tc, (MVMCollectable *)result, (MVMCollectable *)strand->blob_string);
+            result->body.num_strands++;
+        }
+    });
+    STRAND_CHECK(tc, result);
+    return result;
+}
+
 /* Takes a string that is no longer in NFG form after some concatenation-style
  * operation, and returns a new string that is in NFG. Note that we could do a
  * much, much, smarter thing in the future that doesn't involve all of this
@@ -487,11 +591,11 @@ MVMint64 MVM_string_substrings_equal_nocheck(MVMThreadContext *tc, MVMString *a,
             break;
         case MVM_STRING_GRAPHEME_ASCII:
         case MVM_STRING_GRAPHEME_8:
-            if (b->body.storage_type == MVM_STRING_GRAPHEME_ASCII ||
-                    b->body.storage_type == MVM_STRING_GRAPHEME_8)
+        case MVM_STRING_IN_SITU_8:
+            if (MVM_string_storage_is_8bit(b->body.storage_type))
                 return 0 == memcmp(
-                    a->body.storage.blob_8 + starta,
-                    b->body.storage.blob_8 + startb,
+                    MVM_string_blob_8(a) + starta,
+                    MVM_string_blob_8(b) + startb,
                     length);
             break;
     }
@@ -507,11 +611,8 @@ MVMint64 MVM_string_substrings_equal_nocheck(MVMThreadContext *tc, MVMString *a,
     else if (a->body.storage_type == MVM_STRING_STRAND && b->body.storage_type == MVM_STRING_STRAND) {
         MVMGraphemeIter gia, gib;
         /* Normal path, for the rest of the time. */
-        MVM_string_gi_init(tc, &gia, a);
-        MVM_string_gi_init(tc, &gib, b);
-        /* Move the grapheme iterator if start is not 0 */
-        if (starta) MVM_string_gi_move_to(tc, &gia, starta);
-        if (startb) MVM_string_gi_move_to(tc, &gib, startb);
+        MVM_string_gi_init_at(tc, &gia, a, starta);
+        MVM_string_gi_init_at(tc, &gib, b, startb);
         for (i = 0; i < length; i++)
             if (MVM_string_gi_get_grapheme(tc, &gia) != MVM_string_gi_get_grapheme(tc, &gib))
                 return 0;
@@ -529,8 +630,7 @@ MVMint64 MVM_string_substrings_equal_nocheck(MVMThreadContext *tc, MVMString *a,
                  y = b;           z = a;
             starty = startb; startz = starta;
         }
-        MVM_string_gi_init(tc, &gi_y, y);
-        if (starty) MVM_string_gi_move_to(tc, &gi_y, starty);
+        MVM_string_gi_init_at(tc, &gi_y, y, starty);
         for (i = 0; i < length; i++)
             if (MVM_string_gi_get_grapheme(tc, &gi_y) != MVM_string_get_grapheme_at_nocheck(tc, z, startz + i))
                 return 0;
@@ -550,7 +650,7 @@ static MVMint64 MVM_string_memmem_grapheme32str (MVMThreadContext *tc, MVMString
         needle_buf = MVM_malloc(needle->body.num_graphs * sizeof(MVMGrapheme32));
         if (needle->body.storage_type != MVM_STRING_GRAPHEME_8) MVM_string_gi_init(tc, &n_gi, needle);
         for (i = 0; i < needle->body.num_graphs; i++) {
-            needle_buf[i] = needle->body.storage_type == MVM_STRING_GRAPHEME_8 ? needle->body.storage.blob_8[i] : MVM_string_gi_get_grapheme(tc, &n_gi);
+            needle_buf[i] = needle->body.storage_type == MVM_STRING_GRAPHEME_8 ? MVM_grapheme8_to_32(needle->body.storage.blob_8[i]) : MVM_string_gi_get_grapheme(tc, &n_gi);
         }
     }
     rtrn = MVM_string_memmem_grapheme32(tc, Haystack->body.storage.blob_32, needle_buf ? needle_buf : needle->body.storage.blob_32, H_start, H_graphs, n_graphs);
@@ -588,10 +688,12 @@ MVMint64 MVM_string_index(MVMThreadContext *tc, MVMString *Haystack, MVMString *
             }
             break;
         case MVM_STRING_GRAPHEME_8:
-            if (needle->body.storage_type == MVM_STRING_GRAPHEME_8 || needle->body.num_graphs < 100) {
+        case MVM_STRING_IN_SITU_8:
+            if (MVM_string_storage_is_8bit(needle->body.storage_type) || needle->body.num_graphs < 100) {
                 void         *mm_return_8 = NULL;
                 MVMGrapheme8 *needle_buf  = NULL;
-                if (needle->body.storage_type != MVM_STRING_GRAPHEME_8) {
+                MVMGrapheme8 *H_blob_8    = NULL;
+                if (!MVM_string_storage_is_8bit(needle->body.storage_type)) {
                     MVMStringIndex i;
                     MVMGraphemeIter n_gi;
                     needle_buf = MVM_malloc(needle->body.num_graphs * sizeof(MVMGrapheme8));
@@ -606,20 +708,21 @@ MVMint64 MVM_string_index(MVMThreadContext *tc, MVMString *Haystack, MVMString *
                             MVM_free(needle_buf);
                             return -1;
                         }
-                        needle_buf[i] = g;
+                        needle_buf[i] = MVM_grapheme32_to_8(g);
                     }
                 }
+                H_blob_8 = MVM_string_blob_8(Haystack);
                 mm_return_8 = MVM_memmem(
-                    Haystack->body.storage.blob_8 + start, /* start position */
+                    H_blob_8 + start, /* start position */
                     (H_graphs - start) * sizeof(MVMGrapheme8), /* length of Haystack from start position to end */
-                    needle_buf ? needle_buf : needle->body.storage.blob_8, /* needle start */
+                    needle_buf ? needle_buf : MVM_string_blob_8(needle), /* needle start */
                     n_graphs * sizeof(MVMGrapheme8) /* needle length */
                 );
                 if (needle_buf) MVM_free(needle_buf);
                 if (mm_return_8 == NULL)
                     return -1;
                 else
-                    return (MVMGrapheme8*)mm_return_8 -  Haystack->body.storage.blob_8;
+                    return (MVMGrapheme8*)mm_return_8 - H_blob_8;
             }
             break;
     }
@@ -627,8 +730,7 @@ MVMint64 MVM_string_index(MVMThreadContext *tc, MVMString *Haystack, MVMString *
     if (n_graphs == 1) {
         MVMGraphemeIter H_gi;
         MVMGrapheme32 n_g = MVM_string_get_grapheme_at_nocheck(tc, needle, 0);
-        MVM_string_gi_init(tc, &H_gi, Haystack);
-        if (index) MVM_string_gi_move_to(tc, &H_gi, index);
+        MVM_string_gi_init_at(tc, &H_gi, Haystack, index);
         while (index < H_graphs) {
             if (n_g == MVM_string_gi_get_grapheme(tc, &H_gi))
                 return (MVMint64)index;
@@ -750,7 +852,14 @@ MVMString * MVM_string_substring(MVMThreadContext *tc, MVMString *a, MVMint64 of
     MVMROOT(tc, a, {
         result = (MVMString *)MVM_repr_alloc_init(tc, tc->instance->VMString);
         result->body.num_graphs = end_pos - start_pos;
-        if (a->body.storage_type != MVM_STRING_STRAND) {
+        if (result->body.num_graphs <= MVM_STRING_IN_SITU_8_MAX) {
+            /* Short enough that copying is cheaper than a strand, and it may
+             * well fit in situ. */
+            MVMGraphemeIter gi;
+            MVM_string_gi_init_at(tc, &gi, a, start_pos);
+            iterate_gi_into_string(tc, &gi, result, a, start_pos);
+        }
+        else if (a->body.storage_type != MVM_STRING_STRAND) {
             /* It's some kind of buffer. Construct a strand view into it. */
             result->body.storage_type    = MVM_STRING_STRAND;
             result->body.storage.strands = allocate_strands(tc, 1);
@@ -777,8 +886,7 @@ MVMString * MVM_string_substring(MVMThreadContext *tc, MVMString *a, MVMint64 of
         else {
             /* Produce a new blob string, collapsing the strands. */
             MVMGraphemeIter gi;
-            MVM_string_gi_init(tc, &gi, a);
-            MVM_string_gi_move_to(tc, &gi, start_pos);
+            MVM_string_gi_init_at(tc, &gi, a, start_pos);
             iterate_gi_into_string(tc, &gi, result, a, start_pos);
         }
     });
@@ -843,6 +951,7 @@ static MVMuint32 final_strand_match_with_repetition_count(MVMThreadContext *tc,
 }
 
 /* Append one string to another. */
+#define STRANDS_OR_ONE(s) ((s)->body.storage_type == MVM_STRING_STRAND ? (s)->body.num_strands : 1)
 MVMString * MVM_string_concatenate(MVMThreadContext *tc, MVMString *a, MVMString *b) {
     MVMString *result = NULL, *renormalized_section = NULL;
     MVMuint32 renormalized_section_graphs = 0, consumed_a = 0, consumed_b = 0;
@@ -912,6 +1021,22 @@ MVMString * MVM_string_concatenate(MVMThreadContext *tc, MVMString *a, MVMString
             "Can't concatenate strings, required number of graphemes %"PRIu64" > max allowed of %lld",
              total_graphs, MAX_GRAPHEMES);
 
+    /* If both are 8-bit and the result is short, copying them in situ is
+     * cheaper than making strands (and cheaper to use later, too). */
+    if (is_concat_stable == 1 && total_graphs <= MVM_STRING_IN_SITU_8_MAX
+            && MVM_string_storage_is_8bit(a->body.storage_type)
+            && MVM_string_storage_is_8bit(b->body.storage_type)) {
+        MVMROOT2(tc, a, b, {
+            result = (MVMString *)MVM_repr_alloc_init(tc, tc->instance->VMString);
+        });
+        result->body.num_graphs   = (MVMuint32)total_graphs;
+        result->body.storage_type = MVM_STRING_IN_SITU_8;
+        memcpy(result->body.storage.in_situ_8, MVM_string_blob_8(a), agraphs);
+        memcpy(result->body.storage.in_situ_8 + agraphs, MVM_string_blob_8(b), bgraphs);
+        NFG_CHECK_CONCAT(tc, result, a, b, "'result'");
+        return result;
+    }
+
     /* Otherwise, we'll assemble a result string. */
     MVMROOT4(tc, a, b, renormalized_section, result, {
 
@@ -948,18 +1073,38 @@ MVMString * MVM_string_concatenate(MVMThreadContext *tc, MVMString *a, MVMString
             MVMString *effective_a = a;
             MVMString *effective_b = b;
             if (MVM_STRING_MAX_STRANDS < strands_a + strands_b) {
-                MVMROOT(tc, result, {
+                MVMROOT3(tc, result, effective_a, effective_b, {
+                    /* Rebalance the side with the most strands first, and
+                     * then the other one if that wasn't enough. */
                     if (strands_b <= strands_a) {
-                        MVMROOT(tc, effective_b, {
-                            effective_a = collapse_strands(tc, effective_a);
-                        });
-                        strands_a   = 1;
+                        effective_a = rebalance_strands(tc, effective_a);
+                        strands_a   = STRANDS_OR_ONE(effective_a);
                     }
                     else {
-                        MVMROOT(tc, effective_a, {
+                        effective_b = rebalance_strands(tc, effective_b);
+                        strands_b   = STRANDS_OR_ONE(effective_b);
+                    }
+                    if (MVM_STRING_MAX_STRANDS < strands_a + strands_b) {
+                        if (strands_b <= strands_a) {
+                            effective_b = rebalance_strands(tc, effective_b);
+                            strands_b   = STRANDS_OR_ONE(effective_b);
+                        }
+                        else {
+                            effective_a = rebalance_strands(tc, effective_a);
+                            strands_a   = STRANDS_OR_ONE(effective_a);
+                        }
+                    }
+                    /* Should never happen, given the geometric sizes, but
+                     * fall back to collapsing the bigger side entirely. */
+                    if (MVM_STRING_MAX_STRANDS < strands_a + strands_b) {
+                        if (strands_b <= strands_a) {
+                            effective_a = collapse_strands(tc, effective_a);
+                            strands_a   = 1;
+                        }
+                        else {
                             effective_b = collapse_strands(tc, effective_b);
-                        });
-                        strands_b   = 1;
+                            strands_b   = 1;
+                        }
                     }
                 });
             }
@@ -1455,6 +1600,9 @@ MVMint64 MVM_string_equal(MVMThreadContext *tc, MVMString *a, MVMString *b) {
 
     if (a == b)
         return 1;
+    /* Distinct interned strings are known to differ. */
+    if (MVM_string_both_interned(a, b))
+        return 0;
 
     agraphs = MVM_string_graphs_nocheck(tc, a);
     bgraphs = MVM_string_graphs_nocheck(tc, b);
@@ -1519,10 +1667,117 @@ MVMint64 MVM_string_index_of_grapheme(MVMThreadContext *tc, MVMString *a, MVMGra
 
 /* Case change functions. */
 MVMint64 MVM_string_grapheme_is_cclass(MVMThreadContext *tc, MVMint64 cclass, MVMGrapheme32 g);
+
+/* Computes the table for case changing 8-bit graphemes and installs it in the
+ * instance, unless another thread got there first. The first 256 bytes map
+ * each grapheme to its changed form, or to 0 if it needs the full treatment
+ * (it's a synthetic, or it expands or changes to something that won't fit in
+ * 8 bits). After them comes the set of graphemes that don't map to
+ * themselves, laid out as find_uint8_in_set wants. */
+#define CASE_CHANGE_8BIT_SET 256
+static MVMuint8 * build_case_change_8bit(MVMThreadContext *tc, MVMint32 type) {
+    MVMuint8  *table = MVM_calloc(CASE_CHANGE_8BIT_SET + 32, 1);
+    MVMuint32  i;
+    for (i = 0; i < 256; i++) {
+        MVMGrapheme32 changed = i;
+        if ((MVMuint8)(i - 0x80) < MVM_GRAPHEME8_NUM_SYNTHS) {
+            changed = -1;
+        }
+        else {
+            const MVMCodepoint *result_cps;
+            MVMuint32 num_result_cps = MVM_unicode_get_case_change(tc, i, type, &result_cps);
+            if (num_result_cps == 1)
+                changed = 0 <= *result_cps && can_fit_into_8bit(*result_cps) ? *result_cps : -1;
+            else if (num_result_cps > 1)
+                changed = -1;
+        }
+        if (changed == (MVMGrapheme32)i) {
+            table[i] = i;
+        }
+        else {
+            table[i] = changed < 0 ? 0 : changed;
+            table[CASE_CHANGE_8BIT_SET + ((i & 0x0F) | ((i & 0x80) >> 3))] |= 1 << ((i >> 4) & 7);
+        }
+    }
+    MVM_barrier();
+    if (MVM_casptr(&(tc->instance->case_change_8bit[type]), NULL, table) != NULL) {
+        MVM_free(table);
+        table = tc->instance->case_change_8bit[type];
+    }
+    return table;
+}
+
+/* Case changes a string with 8-bit storage by table lookup, returning the
+ * string itself if nothing changes. Returns NULL if any grapheme needs the
+ * full treatment, leaving the caller to fall back to that. */
+static MVMString * case_change_8bit(MVMThreadContext *tc, MVMString *s, MVMint32 type) {
+    MVMuint8       *table = tc->instance->case_change_8bit[type];
+    MVMStringIndex  sgraphs = MVM_string_graphs_nocheck(tc, s);
+    MVMStringIndex  first, i;
+    MVMGrapheme8   *blob_8, *result_buf;
+    MVMString      *result;
+    MVMint32        changed = 0;
+
+    if (MVM_UNLIKELY(!table))
+        table = build_case_change_8bit(tc, type);
+
+    /* Skip ahead to the first grapheme that may change; if there's none,
+     * we're done without allocating anything. */
+    blob_8 = MVM_string_blob_8(s);
+    first  = find_uint8_in_set(blob_8, sgraphs, table + CASE_CHANGE_8BIT_SET);
+    if (first == sgraphs)
+        return s;
+
+    /* Check the rest for anything we can't map here. Synthetics are fine so
+     * long as they don't change. */
+    for (i = first; i < sgraphs; i++) {
+        MVMGrapheme8 g = blob_8[i];
+        if (table[g] == g)
+            continue;
+        if (table[g] == 0) {
+            MVMGrapheme32 *transformed;
+            if ((MVMuint8)(g - 0x80) >= MVM_GRAPHEME8_NUM_SYNTHS
+                    || MVM_nfg_get_case_change(tc, MVM_grapheme8_to_32(g), type, &transformed))
+                return NULL;
+        }
+        else {
+            changed = 1;
+        }
+    }
+    if (!changed)
+        return s;
+
+    MVMROOT(tc, s, {
+        result = (MVMString *)MVM_repr_alloc_init(tc, tc->instance->VMString);
+    });
+    result->body.num_graphs = sgraphs;
+    if (sgraphs <= MVM_STRING_IN_SITU_8_MAX) {
+        result->body.storage_type = MVM_STRING_IN_SITU_8;
+        result_buf = result->body.storage.in_situ_8;
+    }
+    else {
+        /* ASCII only ever changes case to ASCII. */
+        result->body.storage_type   = s->body.storage_type;
+        result_buf = result->body.storage.blob_8 = MVM_malloc(sgraphs);
+    }
+    blob_8 = MVM_string_blob_8(s);
+    memcpy(result_buf, blob_8, first);
+    for (i = first; i < sgraphs; i++) {
+        MVMGrapheme8 g = blob_8[i];
+        result_buf[i] = table[g] ? table[g] : g;
+    }
+    return result;
+}
+
 static MVMString * do_case_change(MVMThreadContext *tc, MVMString *s, MVMint32 type, char *error) {
     MVMint64 sgraphs;
     MVM_string_check_arg(tc, s, error);
     sgraphs = MVM_string_graphs_nocheck(tc, s);
+    if (sgraphs && MVM_string_storage_is_8bit(s->body.storage_type)) {
+        MVMString *result = case_change_8bit(tc, s, type);
+        if (result)
+            return result;
+    }
     if (sgraphs) {
         MVMString *result;
         MVMGraphemeIter gi;
@@ -1915,11 +2170,13 @@ void copy_to_32bit (MVMThreadContext *tc, MVMString *source,
             break;
         }
         case MVM_STRING_GRAPHEME_ASCII:
-        case MVM_STRING_GRAPHEME_8: {
+        case MVM_STRING_GRAPHEME_8:
+        case MVM_STRING_IN_SITU_8: {
+            MVMGrapheme8  *blob_8 = MVM_string_blob_8(source);
             MVMStringIndex sindex = 0;
             while (sindex < source->body.num_graphs)
                 dest->body.storage.blob_32[(*position)++] =
-                    source->body.storage.blob_8[sindex++];
+                    MVM_grapheme8_to_32(blob_8[sindex++]);
             break;
         }
         default:
@@ -1978,8 +2235,15 @@ MVM_STATIC_INLINE MVMString * join_get_str_from_pos(MVMThreadContext *tc, MVMObj
 MVMString * MVM_string_ascii_from_buf_nocheck(MVMThreadContext *tc, MVMGrapheme8 *buf, MVMStringIndex len) {
     MVMString *result = (MVMString *)MVM_repr_alloc_init(tc, tc->instance->VMString);
     result->body.num_graphs     = len;
-    result->body.storage_type   = MVM_STRING_GRAPHEME_ASCII;
-    result->body.storage.blob_8 = buf;
+    if (len <= MVM_STRING_IN_SITU_8_MAX) {
+        result->body.storage_type = MVM_STRING_IN_SITU_8;
+        memcpy(result->body.storage.in_situ_8, buf, len);
+        MVM_free(buf);
+    }
+    else {
+        result->body.storage_type   = MVM_STRING_GRAPHEME_ASCII;
+        result->body.storage.blob_8 = buf;
+    }
     return result;
 }
 MVMString * MVM_string_join(MVMThreadContext *tc, MVMString *separator, MVMObject *input) {
@@ -2183,11 +2447,12 @@ MVMint64 MVM_string_char_at_in_string(MVMThreadContext *tc, MVMString *a, MVMint
         }
         break;
     case MVM_STRING_GRAPHEME_8:
+    case MVM_STRING_IN_SITU_8:
         if (can_fit_into_8bit(search)) {
-            MVMStringIndex i;
-            for (i = 0; i < H_graphs; i++)
-                if (Haystack->body.storage.blob_8[i] == search)
-                    return i;
+            MVMGrapheme8 *blob_8 = MVM_string_blob_8(Haystack);
+            MVMGrapheme8 *found  = memchr(blob_8, MVM_grapheme32_to_8(search), H_graphs);
+            if (found)
+                return found - blob_8;
         }
         break;
     case MVM_STRING_STRAND: {
@@ -2339,6 +2604,15 @@ MVMString * MVM_string_flip(MVMThreadContext *tc, MVMString *s) {
         res->body.storage.blob_8  = rbuffer;
         break;
     }
+    case MVM_STRING_IN_SITU_8: {
+        MVMROOT(tc, s, {
+            res = (MVMString *)MVM_repr_alloc_init(tc, tc->instance->VMString);
+        });
+        res->body.storage_type = MVM_STRING_IN_SITU_8;
+        for (; spos < sgraphs; spos++)
+            res->body.storage.in_situ_8[--rpos] = s->body.storage.in_situ_8[spos];
+        break;
+    }
     default: {
         MVMGrapheme32  *rbuffer;
         rbuffer = MVM_malloc(sizeof(MVMGrapheme32) * sgraphs);
@@ -2391,20 +2665,13 @@ MVMint64 MVM_string_compare(MVMThreadContext *tc, MVMString *a, MVMString *b) {
     if (a->body.storage_type == MVM_STRING_STRAND || b->body.storage_type == MVM_STRING_STRAND) {
 
     }
-    else if ((a->body.storage_type == MVM_STRING_GRAPHEME_8 || a->body.storage_type == MVM_STRING_GRAPHEME_ASCII)
-          && (b->body.storage_type == MVM_STRING_GRAPHEME_8 || b->body.storage_type == MVM_STRING_GRAPHEME_ASCII)) {
-        MVMGrapheme8  *a_blob8 = a->body.storage.blob_8;
-        MVMGrapheme8  *b_blob8 = b->body.storage.blob_8;
-        while (i < scanlen && a_blob8[i] == b_blob8[i]) {
-            i++;
-        }
+    else if (MVM_string_storage_is_8bit(a->body.storage_type)
+          && MVM_string_storage_is_8bit(b->body.storage_type)) {
+        i = mismatch_uint8(MVM_string_blob_8(a), MVM_string_blob_8(b), scanlen);
     }
     else if (a->body.storage_type == MVM_STRING_GRAPHEME_32 && b->body.storage_type == MVM_STRING_GRAPHEME_32) {
-        MVMGrapheme32  *a_blob32 = a->body.storage.blob_32;
-        MVMGrapheme32  *b_blob32 = b->body.storage.blob_32;
-        while (i < scanlen && a_blob32[i] == b_blob32[i]) {
-            i++;
-        }
+        i = mismatch_uint32((uint32_t *)a->body.storage.blob_32,
+            (uint32_t *)b->body.storage.blob_32, scanlen);
     }
     else {
         MVMGrapheme32 *blob32 = NULL;
@@ -2412,7 +2679,8 @@ MVMint64 MVM_string_compare(MVMThreadContext *tc, MVMString *a, MVMString *b) {
         switch (a->body.storage_type) {
             case MVM_STRING_GRAPHEME_8:
             case MVM_STRING_GRAPHEME_ASCII:
-                blob8 = a->body.storage.blob_8;
+            case MVM_STRING_IN_SITU_8:
+                blob8 = MVM_string_blob_8(a);
                 break;
             case MVM_STRING_GRAPHEME_32:
                 blob32 = a->body.storage.blob_32;
@@ -2424,7 +2692,8 @@ MVMint64 MVM_string_compare(MVMThreadContext *tc, MVMString *a, MVMString *b) {
         switch (b->body.storage_type) {
             case MVM_STRING_GRAPHEME_8:
             case MVM_STRING_GRAPHEME_ASCII:
-                blob8 = b->body.storage.blob_8;
+            case MVM_STRING_IN_SITU_8:
+                blob8 = MVM_string_blob_8(b);
                 break;
             case MVM_STRING_GRAPHEME_32:
                 blob32 = b->body.storage.blob_32;
@@ -2433,19 +2702,13 @@ MVMint64 MVM_string_compare(MVMThreadContext *tc, MVMString *a, MVMString *b) {
                 MVM_exception_throw_adhoc(tc,
                     "String corruption in string compare. Unknown string type.");
         }
-        while (i < scanlen && blob32[i] == blob8[i]) {
-            i++;
-        }
+        i = mismatch_uint32_grapheme8((uint32_t *)blob32, blob8, scanlen);
     }
     /* If one of the strings was a strand or we encountered a differing character
      * while scanning in the loops above. */
     if (i < scanlen) {
-        MVM_string_gi_init(tc, &gi_a, a);
-        MVM_string_gi_init(tc, &gi_b, b);
-        if (i) {
-            MVM_string_gi_move_to(tc, &gi_a, i);
-            MVM_string_gi_move_to(tc, &gi_b, i);
-        }
+        MVM_string_gi_init_at(tc, &gi_a, a, i);
+        MVM_string_gi_init_at(tc, &gi_b, b, i);
     }
     for (; i < scanlen; i++) {
         MVMGrapheme32 g_a = MVM_string_gi_get_grapheme(tc, &gi_a);
@@ -2591,15 +2854,9 @@ MVMString * MVM_string_bitxor(MVMThreadContext *tc, MVMString *a, MVMString *b)
 #define STR_WITH_LEN(str)  ("" str ""), (sizeof(str) - 1)
 
 #include "strings/unicode_prop_macros.h"
-/* Checks if the specified grapheme is in the given character class. */
-MVMint64 MVM_string_grapheme_is_cclass(MVMThreadContext *tc, MVMint64 cclass, MVMGrapheme32 g) {
-    /* If it's a synthetic, then grab the base codepoint. */
-    MVMCodepoint cp;
-    if (0 <= g)
-        cp = (MVMCodepoint)g;
-    else
-        cp = MVM_nfg_get_synthetic_info(tc, g)->codes[0];
-
+/* Checks if the specified codepoint is in the given character class, by way
+ * of the Unicode property lookups. */
+static MVMint64 codepoint_is_cclass(MVMThreadContext *tc, MVMint64 cclass, MVMCodepoint cp) {
     switch (cclass) {
         case MVM_CCLASS_ANY:
             return 1;
@@ -2685,6 +2942,136 @@ MVMint64 MVM_string_grapheme_is_cclass(MVMThreadContext *tc, MVMint64 cclass, MV
     }
 }
 
+/* The classes we keep tables for; that is, all but MVM_CCLASS_ANY. */
+#define CCLASS_TABLE_CLASSES (MVM_CCLASS_UPPERCASE | MVM_CCLASS_LOWERCASE | \
+    MVM_CCLASS_ALPHABETIC | MVM_CCLASS_NUMERIC | MVM_CCLASS_HEXADECIMAL | \
+    MVM_CCLASS_WHITESPACE | MVM_CCLASS_PRINTING | MVM_CCLASS_BLANK | \
+    MVM_CCLASS_CONTROL | MVM_CCLASS_PUNCTUATION | MVM_CCLASS_ALPHANUMERIC | \
+    MVM_CCLASS_NEWLINE | MVM_CCLASS_WORD)
+MVM_STATIC_INLINE int cclass_has_table(MVMint64 cclass) {
+    return (cclass & CCLASS_TABLE_CLASSES) && !(cclass & (cclass - 1));
+}
+MVM_STATIC_INLINE MVMuint32 cclass_bit_number(MVMint64 cclass) {
+    MVMuint32 bit = 0;
+    while (!(cclass & 1)) {
+        cclass >>= 1;
+        bit++;
+    }
+    return bit;
+}
+
+/* Computes the classes of a block of 256 BMP codepoints and installs it in
+ * the instance, unless another thread got there first. When doing the block
+ * that Latin-1 falls in, also fills out the stop sets for scanning 8-bit
+ * strings (laid out as find_uint8_in_set wants); bytes that are synthetics
+ * are always stopped at, so they can be checked exactly. */
+static MVMuint16 * build_cclass_block(MVMThreadContext *tc, MVMuint32 block) {
+    MVMuint16 *classes = MVM_malloc(256 * sizeof(MVMuint16));
+    MVMuint32  i, bit;
+    for (i = 0; i < 256; i++) {
+        classes[i] = 0;
+        for (bit = 0; bit < 14; bit++)
+            if (((1 << bit) & CCLASS_TABLE_CLASSES)
+                    && codepoint_is_cclass(tc, 1 << bit, (MVMCodepoint)(block << 8 | i)))
+                classes[i] |= 1 << bit;
+    }
+    if (block == 0) {
+        /* Built aside, as a thread that lost a race to install the block
+         * may still be copying these in while others scan with them; that's
+         * fine as long as it only ever writes the final values. */
+        MVMuint8 stops[14][2][32];
+        memset(stops, 0, sizeof(stops));
+        for (bit = 0; bit < 14; bit++) {
+            for (i = 0; i < 256; i++) {
+                MVMuint32 member = !!(classes[i] & (1 << bit));
+                MVMuint32 synth  = (MVMuint8)(i - 0x80) < MVM_GRAPHEME8_NUM_SYNTHS;
+                MVMuint8  mask   = 1 << ((i >> 4) & 7);
+                MVMuint32 slot   = (i & 0x0F) | ((i & 0x80) >> 3);
+                if (synth || member)
+                    stops[bit][1][slot] |= mask;
+                if (synth || !member)
+                    stops[bit][0][slot] |= mask;
+            }
+        }
+        memcpy(tc->instance->cclass_8bit_stops, stops, sizeof(stops));
+    }
+    MVM_barrier();
+    if (MVM_casptr(&(tc->instance->cclass_blocks[block]), NULL, classes) != NULL) {
+        MVM_free(classes);
+        classes = tc->instance->cclass_blocks[block];
+    }
+    return classes;
+}
+
+/* Looks up the classes of a BMP codepoint in the tables. */
+MVM_STATIC_INLINE MVMuint16 bmp_cclasses(MVMThreadContext *tc, MVMCodepoint cp) {
+    MVMuint16 *classes = tc->instance->cclass_blocks[cp >> 8];
+    if (MVM_UNLIKELY(!classes))
+        classes = build_cclass_block(tc, cp >> 8);
+    return classes[cp & 0xFF];
+}
+
+/* Checks if the specified grapheme is in the given character class. */
+MVMint64 MVM_string_grapheme_is_cclass(MVMThreadContext *tc, MVMint64 cclass, MVMGrapheme32 g) {
+    /* If it's a synthetic, then grab the base codepoint. */
+    MVMCodepoint cp;
+    if (0 <= g)
+        cp = (MVMCodepoint)g;
+    else
+        cp = MVM_nfg_get_synthetic_info(tc, g)->codes[0];
+
+    if (cp < 0x10000 && cclass_has_table(cclass))
+        return !!(bmp_cclasses(tc, cp) & cclass);
+    return codepoint_is_cclass(tc, cclass, cp);
+}
+
+/* The same, with the common case of a BMP codepoint inlined; for scans. */
+MVM_STATIC_INLINE MVMint64 grapheme_is_cclass(MVMThreadContext *tc, MVMint64 cclass, MVMGrapheme32 g) {
+    if (0 <= g && g < 0x10000 && cclass_has_table(cclass))
+        return !!(bmp_cclasses(tc, g) & cclass);
+    return MVM_string_grapheme_is_cclass(tc, cclass, g);
+}
+
+/* Searches from offset up to end for the first grapheme that is in the class
+ * (if in_class is set) or not in it (if in_class is 0). Over 8-bit strings,
+ * we let find_uint8_in_set skip ahead to the next grapheme that could be a
+ * match. */
+static MVMint64 scan_cclass(MVMThreadContext *tc, MVMint64 cclass, MVMString *s,
+        MVMint64 offset, MVMint64 end, MVMint64 in_class) {
+    MVMGraphemeIter gi;
+    MVMint64        pos;
+
+    if (MVM_string_storage_is_8bit(s->body.storage_type) && cclass_has_table(cclass)) {
+        MVMGrapheme8 *blob_8 = MVM_string_blob_8(s);
+        MVMuint8     *stops;
+        /* The only ASCII members of these two are \t..\r and space, which
+         * find_uint8_in_range can look for without needing SSSE3. */
+        MVMint64 ws_or_nl = in_class
+            && (cclass == MVM_CCLASS_WHITESPACE || cclass == MVM_CCLASS_NEWLINE);
+        bmp_cclasses(tc, 0); /* Ensure the stop sets are built. */
+        stops = tc->instance->cclass_8bit_stops[cclass_bit_number(cclass)][in_class];
+        while (offset < end) {
+            offset += ws_or_nl
+                ? find_uint8_in_range(blob_8 + offset, end - offset,
+                    cclass == MVM_CCLASS_WHITESPACE ? '\t' : '\n', '\r',
+                    cclass == MVM_CCLASS_WHITESPACE ? ' '  : '\n')
+                : find_uint8_in_set(blob_8 + offset, end - offset, stops);
+            if (offset >= end)
+                break;
+            if (grapheme_is_cclass(tc, cclass, MVM_grapheme8_to_32(blob_8[offset])) == in_class)
+                return offset;
+            offset++;
+        }
+        return end;
+    }
+
+    MVM_string_gi_init_at(tc, &gi, s, offset);
+    for (pos = offset; pos < end; pos++)
+        if (grapheme_is_cclass(tc, cclass, MVM_string_gi_get_grapheme(tc, &gi)) == in_class)
+            return pos;
+    return end;
+}
+
 /* Checks if the character at the specified offset is a member of the
  * indicated character class. */
 MVMint64 MVM_string_is_cclass(MVMThreadContext *tc, MVMint64 cclass, MVMString *s, MVMint64 offset) {
@@ -2696,8 +3083,7 @@ MVMint64 MVM_string_is_cclass(MVMThreadContext *tc, MVMint64 cclass, MVMString *
 
 /* Searches for the next char that is in the specified character class. */
 MVMint64 MVM_string_find_cclass(MVMThreadContext *tc, MVMint64 cclass, MVMString *s, MVMint64 offset, MVMint64 count) {
-    MVMGraphemeIter gi;
-    MVMint64        length, end, pos;
+    MVMint64 length, end;
 
     MVM_string_check_arg(tc, s, "find_cclass");
 
@@ -2707,41 +3093,12 @@ MVMint64 MVM_string_find_cclass(MVMThreadContext *tc, MVMint64 cclass, MVMString
     if (offset < 0 || offset >= length)
         return end;
 
-    MVM_string_gi_init(tc, &gi, s);
-    MVM_string_gi_move_to(tc, &gi, offset);
-    switch (cclass) {
-        case MVM_CCLASS_WHITESPACE:
-            for (pos = offset; pos < end; pos++) {
-                MVMGrapheme32 g = MVM_string_gi_get_grapheme(tc, &gi);
-                MVMCodepoint cp = 0 <= g ? g : MVM_nfg_get_synthetic_info(tc, g)->codes[0];
-                if (MVM_CP_is_White_Space(cp))
-                    return pos;
-            }
-            break;
-        case MVM_CCLASS_NEWLINE:
-            for (pos = offset; pos < end; pos++) {
-                MVMGrapheme32 g = MVM_string_gi_get_grapheme(tc, &gi);
-                MVMCodepoint cp = 0 <= g ? g : MVM_nfg_get_synthetic_info(tc, g)->codes[0];
-                if (cp == '\n' || cp == 0x0b || cp == 0x0c || cp == '\r' ||
-                    cp == 0x85 || MVM_CP_is_gencat_name_Zl(cp) || MVM_CP_is_gencat_name_Zp(cp))
-                    return pos;
-            }
-            break;
-        default:
-            for (pos = offset; pos < end; pos++) {
-                MVMGrapheme32 g = MVM_string_gi_get_grapheme(tc, &gi);
-                if (MVM_string_grapheme_is_cclass(tc, cclass, g) > 0)
-                    return pos;
-            }
-    }
-
-    return end;
+    return scan_cclass(tc, cclass, s, offset, end, 1);
 }
 
 /* Searches for the next char that is not in the specified character class. */
 MVMint64 MVM_string_find_not_cclass(MVMThreadContext *tc, MVMint64 cclass, MVMString *s, MVMint64 offset, MVMint64 count) {
-    MVMGraphemeIter gi;
-    MVMint64        length, end, pos;
+    MVMint64 length, end;
 
     MVM_string_check_arg(tc, s, "find_not_cclass");
 
@@ -2751,35 +3108,7 @@ MVMint64 MVM_string_find_not_cclass(MVMThreadContext *tc, MVMint64 cclass, MVMSt
     if (offset < 0 || offset >= length)
         return end;
 
-    MVM_string_gi_init(tc, &gi, s);
-    MVM_string_gi_move_to(tc, &gi, offset);
-    switch (cclass) {
-        case MVM_CCLASS_WHITESPACE:
-            for (pos = offset; pos < end; pos++) {
-                MVMGrapheme32 g = MVM_string_gi_get_grapheme(tc, &gi);
-                MVMCodepoint cp = 0 <= g ? g : MVM_nfg_get_synthetic_info(tc, g)->codes[0];
-                if (!MVM_CP_is_White_Space(cp))
-                    return pos;
-            }
-            break;
-        case MVM_CCLASS_NEWLINE:
-            for (pos = offset; pos < end; pos++) {
-                MVMGrapheme32 g = MVM_string_gi_get_grapheme(tc, &gi);
-                MVMCodepoint cp = 0 <= g ? g : MVM_nfg_get_synthetic_info(tc, g)->codes[0];
-                if (!(cp == '\n' || cp == 0x0b || cp == 0x0c || cp == '\r' ||
-                    cp == 0x85 || MVM_CP_is_gencat_name_Zl(cp) || MVM_CP_is_gencat_name_Zp(cp)))
-                    return pos;
-            }
-            break;
-        default:
-            for (pos = offset; pos < end; pos++) {
-                MVMGrapheme32 g = MVM_string_gi_get_grapheme(tc, &gi);
-                if (!MVM_string_grapheme_is_cclass(tc, cclass, g))
-                    return pos;
-            }
-    }
-
-    return end;
+    return scan_cclass(tc, cclass, s, offset, end, 0);
 }
 
 static MVMint16   encoding_name_init         = 0;
@@ -2871,9 +3200,8 @@ MVMString * MVM_string_chr(MVMThreadContext *tc, MVMint64 cp) {
 
     s = (MVMString *)REPR(tc->instance->VMString)->allocate(tc, STABLE(tc->instance->VMString));
     if (can_fit_into_8bit(g)) {
-        s->body.storage_type       = MVM_STRING_GRAPHEME_8;
-        s->body.storage.blob_8     = MVM_malloc(sizeof(MVMGrapheme8));
-        s->body.storage.blob_8[0]  = g;
+        s->body.storage_type         = MVM_STRING_IN_SITU_8;
+        s->body.storage.in_situ_8[0] = MVM_grapheme32_to_8(g);
     } else {
         s->body.storage_type       = MVM_STRING_GRAPHEME_32;
         s->body.storage.blob_32    = MVM_malloc(sizeof(MVMGrapheme32));
@@ -2895,7 +3223,7 @@ typedef union {
  * If this isn't set, MVM_MAYBE_TO_LITTLE_ENDIAN_32 does nothing (the default).
  * This would mainly be useful for debugging or if there were some other reason
  * someone cared that hashes were identical on different endian platforms */
-MVMuint64 MVM_string_compute_hash_code(MVMThreadContext *tc, MVMString *s) {
+MVM_STATIC_INLINE MVMuint64 compute_hash_code(MVMThreadContext *tc, MVMString *s, const int c, const int d) {
 #if defined(MVM_HASH_FORCE_LITTLE_ENDIAN)
     const MVMuint64 key[2] = {
         MVM_MAYBE_TO_LITTLE_ENDIAN_64(tc->instance->hashSecrets[0]),
@@ -2908,29 +3236,32 @@ MVMuint64 MVM_string_compute_hash_code(MVMThreadContext *tc, MVMString *s) {
     MVMStringIndex s_len = MVM_string_graphs_nocheck(tc, s);
     switch (s->body.storage_type) {
         case MVM_STRING_GRAPHEME_8:
-        case MVM_STRING_GRAPHEME_ASCII: {
+        case MVM_STRING_GRAPHEME_ASCII:
+        case MVM_STRING_IN_SITU_8: {
+            MVMGrapheme8 *blob_8 = MVM_string_blob_8(s);
             size_t i;
             MVMJenHashGraphemeView gv;
             siphash sh;
             siphashinit(&sh, s_len * sizeof(MVMGrapheme32), key);
             for (i = 0; i + 1 < s_len;) {
-                gv.graphs[0] = MVM_MAYBE_TO_LITTLE_ENDIAN_32(s->body.storage.blob_8[i++]);
-                gv.graphs[1] = MVM_MAYBE_TO_LITTLE_ENDIAN_32(s->body.storage.blob_8[i++]);
-                siphashadd64bits(&sh, gv.u64);
+                gv.graphs[0] = MVM_MAYBE_TO_LITTLE_ENDIAN_32(MVM_grapheme8_to_32(blob_8[i++]));
+                gv.graphs[1] = MVM_MAYBE_TO_LITTLE_ENDIAN_32(MVM_grapheme8_to_32(blob_8[i++]));
+                siphashadd64bits_cd(&sh, gv.u64, c);
             }
             /* If there is a final 32 bit grapheme pass it through, otherwise
              * pass through 0. */
-            hash = siphashfinish_32bits(&sh,
+            hash = siphashfinish_32bits_cd(&sh,
                 i < s_len
-                    ? MVM_MAYBE_TO_LITTLE_ENDIAN_32(s->body.storage.blob_8[i]) : 0);
+                    ? MVM_MAYBE_TO_LITTLE_ENDIAN_32(MVM_grapheme8_to_32(blob_8[i])) : 0,
+                c, d);
             break;
         }
 #if !defined(MVM_HASH_FORCE_LITTLE_ENDIAN)
         case MVM_STRING_GRAPHEME_32: {
-            hash = siphash24(
+            hash = siphash_cd(
                 (MVMuint8*)s->body.storage.blob_32,
                 s_len * sizeof(MVMGrapheme32),
-                key);
+                key, c, d);
             break;
         }
 #endif
@@ -2944,14 +3275,23 @@ MVMuint64 MVM_string_compute_hash_code(MVMThreadContext *tc, MVMString *s) {
             for (i = 0; i + 1 < s_len; i += 2) {
                 gv.graphs[0] = MVM_MAYBE_TO_LITTLE_ENDIAN_32(MVM_string_gi_get_grapheme(tc, &gi));
                 gv.graphs[1] = MVM_MAYBE_TO_LITTLE_ENDIAN_32(MVM_string_gi_get_grapheme(tc, &gi));
-                siphashadd64bits(&sh, gv.u64);
+                siphashadd64bits_cd(&sh, gv.u64, c);
             }
-            hash = siphashfinish_32bits(&sh,
+            hash = siphashfinish_32bits_cd(&sh,
                 i < s_len
                     ? MVM_MAYBE_TO_LITTLE_ENDIAN_32(MVM_string_gi_get_grapheme(tc, &gi))
-                    : 0);
+                    : 0,
+                c, d);
             break;
         }
     }
     return s->body.cached_hash_code = hash;
 }
+
+/* The round counts are passed as constants so that each variant gets its own
+ * fully unrolled copy of the above. */
+MVMuint64 MVM_string_compute_hash_code(MVMThreadContext *tc, MVMString *s) {
+    return MVM_UNLIKELY(tc->instance->string_hash_siphash24)
+        ? compute_hash_code(tc, s, 2, 4)
+        : compute_hash_code(tc, s, 1, 3);
+}
@@ -65,12 +65,15 @@ MVM_STATIC_INLINE MVMuint32 MVM_string_codes(MVMThreadContext *tc, MVMString *s)
 }
 MVM_STATIC_INLINE int MVM_string_buf32_can_fit_into_8bit(MVMGrapheme32 *active_blob, MVMStringIndex blob_len) {
     MVMStringIndex i;
-    MVMGrapheme32 val = 0;
+    MVMuint32 val = 0;
     MVM_VECTORIZE_LOOP
     for (i = 0; i  < blob_len; i++) {
         /* This could be written val |= ..., but GCC 7 doesn't recognize the
-         * operation as ossociative unless we use a temp variable (clang has no issue). */
-        MVMGrapheme32 val2 = ((active_blob[i] & 0xffffff80) + 0x80) & (0xffffff80-1);
+         * operation as ossociative unless we use a temp variable (clang has no issue).
+         * See MVM_grapheme32_can_fit_into_8bit for the ranges. */
+        MVMuint32 g    = (MVMuint32)active_blob[i];
+        MVMuint32 val2 = !((g < 0x80) | (g - 0xA0 < 0x60)
+            | (g + MVM_GRAPHEME8_NUM_SYNTHS < MVM_GRAPHEME8_NUM_SYNTHS));
         val |= val2;
     }
     return val ? 0 : 1;
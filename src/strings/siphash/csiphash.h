@@ -98,12 +98,27 @@ typedef struct siphash siphash;
     d = ROTATE(d, t) ^ c;       \
     a = ROTATE(a, 32);
 
-#define DOUBLE_ROUND(v0,v1,v2,v3)  \
-    HALF_ROUND(v0,v1,v2,v3,13,16); \
-    HALF_ROUND(v2,v1,v0,v3,17,21); \
+#define SINGLE_ROUND(v0,v1,v2,v3)  \
     HALF_ROUND(v0,v1,v2,v3,13,16); \
     HALF_ROUND(v2,v1,v0,v3,17,21);
 
+#define DOUBLE_ROUND(v0,v1,v2,v3)  \
+    SINGLE_ROUND(v0,v1,v2,v3);     \
+    SINGLE_ROUND(v0,v1,v2,v3);
+
+/* SipHash-c-d does c compression rounds per 64 bit word and d finalization
+ * rounds. The reference SipHash-2-4 is the conservative choice; SipHash-1-3
+ * does roughly half the work for the short keys we typically hash, and is
+ * what Python, Rust and Ruby settled on for their hash tables. The round
+ * counts are always passed as constants, so once inlined these loops unroll
+ * away. */
+MVM_STATIC_INLINE void siphashrounds (siphash *sh, const int rounds) {
+    int i;
+    for (i = 0; i < rounds; i++) {
+        SINGLE_ROUND(sh->v0,sh->v1,sh->v2,sh->v3);
+    }
+}
+
 MVM_STATIC_INLINE void siphashinit (siphash *sh, size_t src_sz, const uint64_t key[2]) {
     const uint64_t k0 = MVM_MAYBE_TO_LITTLE_ENDIAN_64(key[0]);
     const uint64_t k1 = MVM_MAYBE_TO_LITTLE_ENDIAN_64(key[1]);
@@ -113,20 +128,25 @@ MVM_STATIC_INLINE void siphashinit (siphash *sh, size_t src_sz, const uint64_t k
     sh->v2 = k0 ^ 0x6c7967656e657261ULL;
     sh->v3 = k1 ^ 0x7465646279746573ULL;
 }
-MVM_STATIC_INLINE void siphashadd64bits (siphash *sh, const uint64_t in) {
+MVM_STATIC_INLINE void siphashadd64bits_cd (siphash *sh, const uint64_t in, const int c) {
     const uint64_t mi = MVM_MAYBE_TO_LITTLE_ENDIAN_64(in);
     sh->v3 ^= mi;
-    DOUBLE_ROUND(sh->v0,sh->v1,sh->v2,sh->v3);
+    siphashrounds(sh, c);
     sh->v0 ^= mi;
 }
-MVM_STATIC_INLINE uint64_t siphashfinish_last_part (siphash *sh, uint64_t t) {
+MVM_STATIC_INLINE void siphashadd64bits (siphash *sh, const uint64_t in) {
+    siphashadd64bits_cd(sh, in, 2);
+}
+MVM_STATIC_INLINE void siphashadd64bits_13 (siphash *sh, const uint64_t in) {
+    siphashadd64bits_cd(sh, in, 1);
+}
+MVM_STATIC_INLINE uint64_t siphashfinish_last_part (siphash *sh, uint64_t t, const int c, const int d) {
     sh->b |= MVM_MAYBE_TO_LITTLE_ENDIAN_64(t);
     sh->v3 ^= sh->b;
-    DOUBLE_ROUND(sh->v0,sh->v1,sh->v2,sh->v3);
+    siphashrounds(sh, c);
     sh->v0 ^= sh->b;
     sh->v2 ^= 0xff;
-    DOUBLE_ROUND(sh->v0,sh->v1,sh->v2,sh->v3);
-    DOUBLE_ROUND(sh->v0,sh->v1,sh->v2,sh->v3);
+    siphashrounds(sh, d);
     return (sh->v0 ^ sh->v1) ^ (sh->v2 ^ sh->v3);
 }
 /* This union helps us avoid doing weird things with pointers that can cause old
@@ -137,12 +157,18 @@ union SipHash64_union {
     uint32_t u32;
     uint8_t  u8[8];
 };
-MVM_STATIC_INLINE uint64_t siphashfinish_32bits (siphash *sh, const uint32_t src) {
+MVM_STATIC_INLINE uint64_t siphashfinish_32bits_cd (siphash *sh, const uint32_t src, const int c, const int d) {
     union SipHash64_union t = { 0 };
     t.u32 = src;
-    return siphashfinish_last_part(sh, t.u64);
+    return siphashfinish_last_part(sh, t.u64, c, d);
 }
-MVM_STATIC_INLINE uint64_t siphashfinish (siphash *sh, const uint8_t *src, size_t src_sz) {
+MVM_STATIC_INLINE uint64_t siphashfinish_32bits (siphash *sh, const uint32_t src) {
+    return siphashfinish_32bits_cd(sh, src, 2, 4);
+}
+MVM_STATIC_INLINE uint64_t siphashfinish_32bits_13 (siphash *sh, const uint32_t src) {
+    return siphashfinish_32bits_cd(sh, src, 1, 3);
+}
+MVM_STATIC_INLINE uint64_t siphashfinish_cd (siphash *sh, const uint8_t *src, size_t src_sz, const int c, const int d) {
     union SipHash64_union t = { 0 };
     switch (src_sz) {
         /* Falls through */
@@ -165,9 +191,15 @@ MVM_STATIC_INLINE uint64_t siphashfinish (siphash *sh, const uint8_t *src, size_
         /* Falls through */
         case 1: t.u8[0] = src[0];
     }
-    return siphashfinish_last_part(sh, t.u64);
+    return siphashfinish_last_part(sh, t.u64, c, d);
 }
-MVM_STATIC_INLINE uint64_t siphash24(const uint8_t *src, size_t src_sz, const uint64_t key[2]) {
+MVM_STATIC_INLINE uint64_t siphashfinish (siphash *sh, const uint8_t *src, size_t src_sz) {
+    return siphashfinish_cd(sh, src, src_sz, 2, 4);
+}
+MVM_STATIC_INLINE uint64_t siphashfinish_13 (siphash *sh, const uint8_t *src, size_t src_sz) {
+    return siphashfinish_cd(sh, src, src_sz, 1, 3);
+}
+MVM_STATIC_INLINE uint64_t siphash_cd(const uint8_t *src, size_t src_sz, const uint64_t key[2], const int c, const int d) {
     siphash sh;
 #if defined(MVM_CAN_UNALIGNED_INT64)
     const uint64_t *in = (uint64_t*)src;
@@ -177,7 +209,7 @@ MVM_STATIC_INLINE uint64_t siphash24(const uint8_t *src, size_t src_sz, const ui
     siphashinit(&sh, src_sz, key);
     src_sz -= src_sz_nearest_8bits;
     while (in < goal) {
-        siphashadd64bits(&sh, *in);
+        siphashadd64bits_cd(&sh, *in, c);
         in++;
     }
 
@@ -187,9 +219,15 @@ MVM_STATIC_INLINE uint64_t siphash24(const uint8_t *src, size_t src_sz, const ui
     while (src_sz >= 8) {
         uint64_t in_64;
         memcpy(&in_64, in, sizeof(uint64_t));
-        siphashadd64bits(&sh, in_64);
+        siphashadd64bits_cd(&sh, in_64, c);
         in += 8; src_sz -= 8;
     }
 #endif
-    return siphashfinish(&sh, (uint8_t *)in, src_sz);
+    return siphashfinish_cd(&sh, (uint8_t *)in, src_sz, c, d);
+}
+MVM_STATIC_INLINE uint64_t siphash24(const uint8_t *src, size_t src_sz, const uint64_t key[2]) {
+    return siphash_cd(src, src_sz, key, 2, 4);
+}
+MVM_STATIC_INLINE uint64_t siphash13(const uint8_t *src, size_t src_sz, const uint64_t key[2]) {
+    return siphash_cd(src, src_sz, key, 1, 3);
 }
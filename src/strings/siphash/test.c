@@ -31,6 +31,25 @@ uint64_t vectors[64] = {
 	0xb78dbfaf3a8d83bdLLU, 0xea1ad565322a1a0bLLU, 0x60e61c23a3795013LLU, 0x6606d7e446282b93LLU,
 	0x6ca4ecb15c5f91e1LLU, 0x9f626da15c9625f3LLU, 0xe51b38608ef25f57LLU, 0x958a324ceb064572LLU,
 };
+/* SipHash-1-3 with the same key and inputs as above */
+uint64_t vectors13[64] = {
+	0xabac0158050fc4dcLLU, 0xc9f49bf37d57ca93LLU, 0x82cb9b024dc7d44dLLU, 0x8bf80ab8e7ddf7fbLLU,
+	0xcf75576088d38328LLU, 0xdef9d52f49533b67LLU, 0xc50d2b50c59f22a7LLU, 0xd3927d989bb11140LLU,
+	0x369095118d299a8eLLU, 0x25a48eb36c063de4LLU, 0x79de85ee92ff097fLLU, 0x70c118c1f94dc352LLU,
+	0x78a384b157b4d9a2LLU, 0x306f760c1229ffa7LLU, 0x605aa111c0f95d34LLU, 0xd320d86d2a519956LLU,
+	0xcc4fdd1a7d908b66LLU, 0x9cf2689063dbd80cLLU, 0x8ffc389cb473e63eLLU, 0xf21f9de58d297d1cLLU,
+	0xc0dc2f46a6cce040LLU, 0xb992abfe2b45f844LLU, 0x7ffe7b9ba320872eLLU, 0x525a0e7fdae6c123LLU,
+	0xf464aeb267349c8cLLU, 0x45cd5928705b0979LLU, 0x3a3e35e3ca9913a5LLU, 0xa91dc74e4ade3b35LLU,
+	0xfb0bed02ef6cd00dLLU, 0x88d93cb44ab1e1f4LLU, 0x540f11d643c5e663LLU, 0x2370dd1f8c21d1bcLLU,
+	0x81157b6c16a7b60dLLU, 0x4d54b9e57a8ff9bfLLU, 0x759f12781f2a753eLLU, 0xcea1a3bebf186b91LLU,
+	0x2cf508d3ada26206LLU, 0xb6101c2da3c33057LLU, 0xb3f47496ae3a36a1LLU, 0x626b57547b108392LLU,
+	0xc1d2363299e41531LLU, 0x667cc1923f1ad944LLU, 0x65704ffec8138825LLU, 0x24f280d1c28949a6LLU,
+	0xc2ca1cedfaf8876bLLU, 0xc2164bfc9f042196LLU, 0xa16e9c9368b1d623LLU, 0x49fb169c8b5114fdLLU,
+	0x9f3143f8df074c46LLU, 0xc6fdaf2412cc86b3LLU, 0x7eaf49d10a52098fLLU, 0x1cf313559d292f9aLLU,
+	0xc44a30dda2f41f12LLU, 0x36fae98943a71ed0LLU, 0x318fb34c73f0bce6LLU, 0xa27abf3670a7e980LLU,
+	0xb4bcc0db243c6d75LLU, 0x23f8d852fdb71513LLU, 0x8f035f4da67d8a08LLU, 0xd89cd0e5b7e8f148LLU,
+	0xf6f4e6bcf7a644eeLLU, 0xaec59ad80f1837f2LLU, 0xc3b2f6154b6694e0LLU, 0x9d199062b7bbb3a8LLU,
+};
 uint32_t stored = 0;
 #define cassert(condition, number) do {\
 	/* If it's true, do nothing. */\
@@ -121,6 +140,23 @@ int testmvm (void) {
 		}
 	});
 	printf("%s %i siphash24 tests finished in %.3fms\n", pass_fail_str(4), REPEATS, (t5-t4)/1000000.);
+	TIME(t0, t1, {
+		for (rep_count = 0; rep_count < REPEATS; rep_count++) {
+			/* Using siphashfinish_32bits_13 */
+			siphash sh;
+			MVMuint64 hash;
+			MVMJenHashGraphemeView gv;
+			siphashinit(&sh, s_len * sizeof(MVMGrapheme32), (uint64_t*)key);
+			for (i = 0; i + 1 < s_len;) {
+				gv.graphs[0] = MVM_TO_LITTLE_ENDIAN_32(Grapheme32[i++]);
+				gv.graphs[1] = MVM_TO_LITTLE_ENDIAN_32(Grapheme32[i++]);
+				siphashadd64bits_13(&sh, gv.u64);
+			}
+			hash = siphashfinish_32bits_13(&sh, i < s_len ? MVM_TO_LITTLE_ENDIAN_32(Grapheme32[i]) : 0);
+			cassert(hash == 17236254730995530697LLU, 6);
+		}
+	});
+	printf("%s %i siphashadd64bits_13 + siphashfinish_32bits_13 tests finished in %.3fms\n", pass_fail_str(6), REPEATS, (t1-t0)/1000000.);
 	return 0;
 }
 int main() {
@@ -141,6 +177,14 @@ int main() {
 		}
 	});
 	printf("%s %i standard tests run in %.3fms, %.0fns per test\n", pass_fail_str(1), REPEATS*64, (t1-t0)/1000000., (t1-t0)/(REPEATS*64.));
+	TIME(t0, t1, {
+		for (j=0; j<REPEATS; j++){
+			for (i=0; i<64; i++) {
+				cassert(siphash13(plaintext, i, (uint64_t*)key) == vectors13[i], 7);
+			}
+		}
+	});
+	printf("%s %i standard SipHash-1-3 tests run in %.3fms, %.0fns per test\n", pass_fail_str(7), REPEATS*64, (t1-t0)/1000000., (t1-t0)/(REPEATS*64.));
 	TIME(t2, t3, {
 		testmvm();
 	});
@@ -174,6 +218,26 @@ int main() {
 		}
 	});
 	printf("Time test: %i 10,000 grapheme strings hashed with siphash24() in %.3fms, %.0fns per test\n", REPEATS/100, (t7-t6)/1000000., (t7-t6)/(REPEATS/100.));
+	/* Most hash keys are short: attribute, method and lexical names. Compare
+	 * the two variants on keys of 1 to 32 graphemes. */
+	{
+		uint32_t graphs[32];
+		uint64_t sink = 0;
+		for (i = 0; i < 32; i++) graphs[i] = 'a' + i;
+		TIME(t6, t7, {
+			for (j = 0; j < REPEATS; j++)
+				for (i = 1; i <= 32; i++)
+					sink ^= siphash24((uint8_t *)graphs, i * sizeof(uint32_t), (uint64_t*)key);
+		});
+		printf("Time test: %i short keys hashed with siphash24() in %.3fms, %.1fns per key\n", REPEATS*32, (t7-t6)/1000000., (t7-t6)/(REPEATS*32.));
+		TIME(t6, t7, {
+			for (j = 0; j < REPEATS; j++)
+				for (i = 1; i <= 32; i++)
+					sink ^= siphash13((uint8_t *)graphs, i * sizeof(uint32_t), (uint64_t*)key);
+		});
+		printf("Time test: %i short keys hashed with siphash13() in %.3fms, %.1fns per key\n", REPEATS*32, (t7-t6)/1000000., (t7-t6)/(REPEATS*32.));
+		if (sink == 42) printf("\n");
+	}
 	printf("\n%s\n", stored?"FAILED at least some of the tests":"PASSED all tests");
 	return stored;
 }
@@ -582,6 +582,13 @@ MVMint64 MVM_unicode_string_compare(MVMThreadContext *tc, MVMString *a, MVMStrin
             break;
         }
     }
+    /* If the codepoints of one string are a prefix of the other's, the one
+     * with fewer codepoints is the lesser. (Counting graphemes instead would
+     * find "x" equal to both "x\x[FE0E]" and "x\x[FE0F]", which differ.) */
+    if (!compare_by_cp_rtrn)
+        compare_by_cp_rtrn = MVM_string_ci_has_more(tc, &a_ci) ?  1 :
+                             MVM_string_ci_has_more(tc, &b_ci) ? -1 :
+                                                                  0 ;
     DEBUG_PRINT_RING_BUFFER(tc, &buf_a);
     DEBUG_PRINT_RING_BUFFER(tc, &buf_b);
     ring_buffer_done(tc, &buf_a);
@@ -671,6 +678,165 @@ MVMint64 MVM_unicode_string_compare(MVMThreadContext *tc, MVMString *a, MVMStrin
     return collation_return_by_quaternary(tc, &level_eval_settings, alen, blen, compare_by_cp_rtrn);
 }
 
+/* A sort key is built by appending big-endian weights to a growable byte
+ * buffer. */
+struct collation_key_buf {
+    MVMuint8 *bytes;
+    size_t    pos;
+    size_t    alloc;
+};
+typedef struct collation_key_buf collation_key_buf;
+static void collation_key_emit(collation_key_buf *kb, MVMuint32 value, int width) {
+    if (kb->alloc < kb->pos + width) {
+        kb->alloc = kb->alloc * 2 + width;
+        kb->bytes = MVM_realloc(kb->bytes, kb->alloc);
+    }
+    switch (width) {
+        case 3: kb->bytes[kb->pos++] = (value >> 16) & 0xFF;
+            /* fall through */
+        case 2: kb->bytes[kb->pos++] = (value >>  8) & 0xFF;
+                kb->bytes[kb->pos++] =  value        & 0xFF;
+    }
+}
+/* Works out the direction of a level in the sort key: 1 if it sorts
+ * ascending, -1 if it sorts descending, and 0 if it is disabled because
+ * neither or both of its bits are set. */
+MVM_STATIC_INLINE int collation_key_level_dir(MVMint64 collation_mode, MVMint64 positive, MVMint64 negative) {
+    int pos = collation_mode & positive ? 1 : 0;
+    int neg = collation_mode & negative ? 1 : 0;
+    return pos - neg;
+}
+/* Computes a binary sort key for the string under the given collation_mode,
+ * such that comparing two keys with memcmp (shorter key first on a common
+ * prefix) orders the strings exactly as MVM_unicode_string_compare does.
+ *
+ * The key of a non-empty string starts with a 0x01 byte. The primary,
+ * secondary and tertiary levels then each contribute their non-ignorable
+ * weights in order, primary as 3 bytes and secondary and tertiary as 2 bytes,
+ * followed by a zero separator of the same width so that a string sorts
+ * before any string it is a prefix of. The quaternary level appends each
+ * codepoint plus one as 3 bytes, so that on a common prefix the string with
+ * fewer codepoints sorts first. For descending levels every value and the
+ * separator is complemented, and the quaternary level ends with 0xFFFFFF.
+ * MVM_unicode_string_compare compares an empty string only by length, so its
+ * key is empty, or the single byte 0x02 when the quaternary level is
+ * descending, placing it before or after every other string.
+ *
+ * Every level must be enabled in one direction. With a level disabled,
+ * MVM_unicode_string_compare is not a consistent order (with the primary
+ * level disabled it finds "ab" < "a" < "abc" < "ab", and with the quaternary
+ * level disabled it finds "" equal to every string), so no key could follow
+ * it, and we throw instead.
+ *
+ * The key is returned in a newly allocated buffer of size *output_size,
+ * which the caller must free. */
+MVMuint8 * MVM_unicode_string_collation_key_bytes(MVMThreadContext *tc, MVMString *s,
+         MVMint64 collation_mode, MVMint64 lang_mode, MVMint64 country_mode, MVMuint64 *output_size) {
+    static const MVMint64 positive[4] = {
+        MVM_COLLATION_PRIMARY_POSITIVE,  MVM_COLLATION_SECONDARY_POSITIVE,
+        MVM_COLLATION_TERTIARY_POSITIVE, MVM_COLLATION_QUATERNARY_POSITIVE
+    };
+    static const MVMint64 negative[4] = {
+        MVM_COLLATION_PRIMARY_NEGATIVE,  MVM_COLLATION_SECONDARY_NEGATIVE,
+        MVM_COLLATION_TERTIARY_NEGATIVE, MVM_COLLATION_QUATERNARY_NEGATIVE
+    };
+    /* Widths in bytes of the weights for each level. Primary weights fit in
+     * 17 bits (implicit weights top out at 0xFFFF + 1), secondary and
+     * tertiary in 16. Codepoints plus one fit in 21 bits. */
+    static const int width[4] = { 3, 2, 2, 3 };
+    int dir[4];
+    MVMCodepointIter ci;
+    collation_stack stack;
+    collation_key_buf kb;
+    MVMint64 i;
+    int level;
+
+    MVM_string_check_arg(tc, s, "collation key");
+    for (level = 0; level < 4; level++) {
+        dir[level] = collation_key_level_dir(collation_mode, positive[level], negative[level]);
+        if (!dir[level])
+            MVM_exception_throw_adhoc(tc,
+                "unicollkey_s needs every collation level enabled in one direction, got collation mode %"PRId64,
+                collation_mode);
+    }
+    if (MVM_string_graphs_nocheck(tc, s) == 0) {
+        kb.pos   = 0;
+        kb.bytes = MVM_malloc(1);
+        if (dir[3] < 0)
+            kb.bytes[kb.pos++] = 0x02;
+        *output_size = kb.pos;
+        return kb.bytes;
+    }
+    init_stack(tc, &stack);
+    MVM_string_ci_init(tc, &ci, s, 0, 0);
+    while (grab_from_stack(tc, &ci, &stack, "s"));
+
+    kb.pos   = 0;
+    kb.alloc = (stack.stack_top + 1) * 7 + 8;
+    kb.bytes = MVM_malloc(kb.alloc);
+    kb.bytes[kb.pos++] = 0x01;
+    for (level = 0; level < 3; level++) {
+        MVMuint32 mask = width[level] == 3 ? 0xFFFFFF : 0xFFFF;
+        for (i = 0; i <= stack.stack_top; i++) {
+            MVMuint32 weight = stack.keys[i].a[level];
+            if (weight == collation_zero)
+                continue;
+            collation_key_emit(&kb, dir[level] < 0 ? mask - weight : weight, width[level]);
+        }
+        collation_key_emit(&kb, dir[level] < 0 ? mask : 0, width[level]);
+    }
+    cleanup_stack(tc, &stack);
+
+    /* The quaternary level breaks ties by codepoint, and then by the number
+     * of codepoints. Codepoints are stored plus one so that a descending
+     * U+0000 doesn't collide with the terminator. */
+    MVM_string_ci_init(tc, &ci, s, 0, 0);
+    while (MVM_string_ci_has_more(tc, &ci)) {
+        MVMuint32 cp = (MVMuint32)MVM_string_ci_get_codepoint(tc, &ci) + 1;
+        collation_key_emit(&kb, dir[3] < 0 ? 0xFFFFFF - cp : cp, width[3]);
+    }
+    if (dir[3] < 0)
+        collation_key_emit(&kb, 0xFFFFFF, width[3]);
+
+    *output_size = kb.pos;
+    return kb.bytes;
+}
+/* Computes the sort key of a string as MVM_unicode_string_collation_key_bytes
+ * does, and writes it into the supplied Buf instance, which should be a uint8
+ * array with MVMArray REPR. */
+MVMObject * MVM_unicode_string_collation_key(MVMThreadContext *tc, MVMString *s,
+         MVMint64 collation_mode, MVMint64 lang_mode, MVMint64 country_mode, MVMObject *buf) {
+    MVMuint64 output_size;
+    MVMuint8 *key;
+    MVMArrayREPRData *buf_rd;
+
+    if (!IS_CONCRETE(buf) || REPR(buf)->ID != MVM_REPR_ID_VMArray)
+        MVM_exception_throw_adhoc(tc, "unicollkey_s requires a native array to write into");
+    buf_rd = (MVMArrayREPRData *)STABLE(buf)->REPR_data;
+    if (!buf_rd || buf_rd->slot_type != MVM_ARRAY_U8)
+        MVM_exception_throw_adhoc(tc, "unicollkey_s requires a uint8 native array");
+
+    key = MVM_unicode_string_collation_key_bytes(tc, s, collation_mode,
+        lang_mode, country_mode, &output_size);
+
+    /* Stash the key in the VMArray. */
+    if (((MVMArray *)buf)->body.slots.any) {
+        MVMuint64 prev_elems = ((MVMArray *)buf)->body.elems;
+        MVM_repr_pos_set_elems(tc, buf, prev_elems + output_size);
+        memcpy(((MVMArray *)buf)->body.slots.u8 + ((MVMArray *)buf)->body.start + prev_elems,
+            key, output_size);
+        MVM_free(key);
+    }
+    else {
+        ((MVMArray *)buf)->body.slots.u8 = key;
+        ((MVMArray *)buf)->body.start    = 0;
+        ((MVMArray *)buf)->body.ssize    = output_size;
+        ((MVMArray *)buf)->body.elems    = output_size;
+    }
+
+    return buf;
+}
+
 /* Looks up a codepoint by name. Lazily constructs a hash. */
 MVMGrapheme32 MVM_unicode_lookup_by_name(MVMThreadContext *tc, MVMString *name) {
     char *cname = MVM_string_utf8_encode_C_string(tc, name);
@@ -95,6 +95,32 @@ enum {
     U8_QUAD            = 1 << 8
 };
 
+/* Returns the length of the run of bytes at the start of the buffer that are
+ * ASCII, other than \r. Those are always valid UTF-8, decode to themselves,
+ * and are never significant to normalization (\r is, since \r\n is a single
+ * grapheme), so they can bypass both the decoder and the normalizer. With
+ * SSE2 (part of the x86-64 baseline) we check 16 bytes at a time. */
+#if defined(__SSE2__) && (defined(__GNUC__) || defined(__clang__))
+#include <emmintrin.h>
+#define UTF8_ASCII_RUN_SSE2 1
+#endif
+static size_t ascii_run_length(const MVMuint8 *bytes, size_t len) {
+    size_t i = 0;
+#if defined(UTF8_ASCII_RUN_SSE2)
+    const __m128i cr = _mm_set1_epi8('\r');
+    for (; i + 16 <= len; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(bytes + i));
+        /* High bit set means non-ASCII; the compare sets it for \r too. */
+        int mask  = _mm_movemask_epi8(_mm_or_si128(v, _mm_cmpeq_epi8(v, cr)));
+        if (mask)
+            return i + (size_t)__builtin_ctz((unsigned int)mask);
+    }
+#endif
+    while (i < len && bytes[i] < 0x80 && bytes[i] != '\r')
+        i++;
+    return i;
+}
+
 static unsigned classify(MVMCodepoint cp) {
     if(cp <= 0x7F)
         return CP_CHAR | U8_SINGLE;
@@ -177,20 +203,51 @@ MVMString * MVM_string_utf8_decode(MVMThreadContext *tc, const MVMObject *result
     MVMint32 line_ending = 0;
     MVMint32 state = 0;
     MVMint32 bufsize = bytes;
-    MVMGrapheme32 *buffer = MVM_malloc(sizeof(MVMGrapheme32) * bufsize);
+    MVMGrapheme32 *buffer;
     size_t orig_bytes;
     const char *orig_utf8;
+    size_t ascii_run;
     MVMint32 line;
     MVMint32 col;
     MVMint32 ready;
-
-    /* Need to normalize to NFG as we decode. */
     MVMNormalizer norm;
+
+    /* If the input is entirely ASCII (and has no \r), it is already valid
+     * and in NFG, so we can copy it straight into 8-bit storage. */
+    ascii_run = ascii_run_length((const MVMuint8 *)utf8, bytes);
+    if (ascii_run == bytes) {
+        if (bytes <= MVM_STRING_IN_SITU_8_MAX) {
+            memcpy(result->body.storage.in_situ_8, utf8, bytes);
+            result->body.storage_type = MVM_STRING_IN_SITU_8;
+        }
+        else {
+            MVMGrapheme8 *blob = MVM_malloc(sizeof(MVMGrapheme8) * bytes);
+            memcpy(blob, utf8, bytes);
+            result->body.storage.blob_8 = blob;
+            result->body.storage_type   = MVM_STRING_GRAPHEME_8;
+        }
+        result->body.num_graphs = bytes;
+        return result;
+    }
+
+    /* Otherwise, need to normalize to NFG as we decode. */
     MVM_unicode_normalizer_init(tc, &norm, MVM_NORMALIZE_NFG);
+    buffer = MVM_malloc(sizeof(MVMGrapheme32) * bufsize);
 
     orig_bytes = bytes;
     orig_utf8 = utf8;
 
+    /* We can still take any leading ASCII as is, except for its final char,
+     * since whatever follows it may combine with it. */
+    if (ascii_run > 1) {
+        size_t i;
+        for (i = 0; i < ascii_run - 1; i++)
+            buffer[i] = (MVMuint8)utf8[i];
+        count = ascii_run - 1;
+        utf8  += count;
+        bytes -= count;
+    }
+
     for (; bytes; ++utf8, --bytes) {
         switch(MVM_EXPECT(decode_utf8_byte(&state, &codepoint, (MVMuint8)*utf8), UTF8_ACCEPT)) {
         case UTF8_ACCEPT: { /* got a codepoint */
@@ -285,14 +342,20 @@ MVMString * MVM_string_utf8_decode(MVMThreadContext *tc, const MVMObject *result
 
     /* If we're lucky, we can fit our string in 8 bits per grapheme. */
     if (MVM_string_buf32_can_fit_into_8bit(buffer, count)) {
-        MVMGrapheme8 *new_buffer = MVM_malloc(sizeof(MVMGrapheme8) * count);
+        MVMGrapheme8 *new_buffer;
+        if (count <= MVM_STRING_IN_SITU_8_MAX) {
+            new_buffer = result->body.storage.in_situ_8;
+            result->body.storage_type    = MVM_STRING_IN_SITU_8;
+        }
+        else {
+            new_buffer = result->body.storage.blob_8 = MVM_malloc(sizeof(MVMGrapheme8) * count);
+            result->body.storage_type    = MVM_STRING_GRAPHEME_8;
+        }
         MVM_VECTORIZE_LOOP
         for (ready = 0; ready < count; ready++) {
-            new_buffer[ready] = buffer[ready];
+            new_buffer[ready] = MVM_grapheme32_to_8(buffer[ready]);
         }
         MVM_free(buffer);
-        result->body.storage.blob_8  = new_buffer;
-        result->body.storage_type    = MVM_STRING_GRAPHEME_8;
     } else {
         /* just keep the same buffer as the MVMString's buffer.  Later
          * we can add heuristics to resize it if we have enough free
@@ -428,6 +491,33 @@ MVMuint32 MVM_string_utf8_decodestream(MVMThreadContext *tc, MVMDecodeStream *ds
             }
 
             while (pos < cur_bytes->length) {
+                /* Runs of ASCII need neither the decoder nor the normalizer,
+                 * so spit them out directly, keeping the last one lagged. */
+                if (state == UTF8_ACCEPT) {
+                    MVMint32 run_end = pos + (MVMint32)ascii_run_length(bytes + pos,
+                        cur_bytes->length - pos);
+                    while (pos < run_end) {
+                        if (count == bufsize) {
+                            MVM_string_decodestream_add_chars(tc, ds, buffer, bufsize);
+                            buffer = MVM_malloc(bufsize * sizeof(MVMGrapheme32));
+                            count = 0;
+                        }
+                        buffer[count++] = lag_codepoint;
+                        total++;
+                        if (MVM_string_decode_stream_maybe_sep(tc, seps, lag_codepoint) ||
+                                (stopper_chars && *stopper_chars == total)) {
+                            reached_stopper = 1;
+                            last_accept_bytes = lag_last_accept_bytes;
+                            last_accept_pos = lag_last_accept_pos;
+                            goto done;
+                        }
+                        lag_codepoint = bytes[pos++];
+                        lag_last_accept_bytes = cur_bytes;
+                        lag_last_accept_pos = pos;
+                    }
+                    if (pos == cur_bytes->length)
+                        break;
+                }
                 switch(MVM_EXPECT(decode_utf8_byte(&state, &codepoint, bytes[pos++]), UTF8_ACCEPT)) {
                 case UTF8_ACCEPT: {
                     /* If we hit something that needs the normalizer, we put
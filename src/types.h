@@ -9,6 +9,7 @@ typedef struct MVMArrayREPRData MVMArrayREPRData;
 typedef struct MVMAsyncTask MVMAsyncTask;
 typedef struct MVMAsyncTaskBody MVMAsyncTaskBody;
 typedef struct MVMAsyncTaskOps MVMAsyncTaskOps;
+typedef struct MVMAttrCache MVMAttrCache;
 typedef struct MVMAttributeIdentifier MVMAttributeIdentifier;
 typedef struct MVMBoolificationSpec MVMBoolificationSpec;
 typedef struct MVMBootTypes MVMBootTypes;
@@ -75,11 +76,14 @@ typedef struct MVMKnowHOWREPR MVMKnowHOWREPR;
 typedef struct MVMKnowHOWREPRBody MVMKnowHOWREPRBody;
 typedef struct MVMNFA MVMNFA;
 typedef struct MVMNFABody MVMNFABody;
+typedef struct MVMNFACompiled MVMNFACompiled;
+typedef struct MVMNFACompiledEdge MVMNFACompiledEdge;
 typedef struct MVMNFAStateInfo MVMNFAStateInfo;
 typedef struct MVMNFGState MVMNFGState;
 typedef struct MVMNFGSynthetic MVMNFGSynthetic;
 typedef struct MVMNFGTrieNode MVMNFGTrieNode;
 typedef struct MVMNFGTrieNodeEntry MVMNFGTrieNodeEntry;
+typedef struct MVMNFGCacheEntry MVMNFGCacheEntry;
 typedef struct MVMNativeCall MVMNativeCall;
 typedef struct MVMNativeCallBody MVMNativeCallBody;
 typedef struct MVMNativeRef MVMNativeRef;
@@ -216,6 +220,7 @@ typedef struct MVMStorageSpec MVMStorageSpec;
 typedef struct MVMString MVMString;
 typedef struct MVMStringBody MVMStringBody;
 typedef struct MVMStringConsts MVMStringConsts;
+typedef union MVMStringStorage MVMStringStorage;
 typedef struct MVMStringStrand MVMStringStrand;
 typedef struct MVMGraphemeIter MVMGraphemeIter;
 typedef struct MVMCodepointIter MVMCodepointIter;
@@ -227,8 +232,10 @@ typedef struct MVMUninstantiable MVMUninstantiable;
 typedef struct MVMWorkThread MVMWorkThread;
 typedef struct MVMIOOps MVMIOOps;
 typedef struct MVMIOClosable MVMIOClosable;
+typedef struct MVMIOEventLoop MVMIOEventLoop;
 typedef struct MVMIOSyncReadable MVMIOSyncReadable;
 typedef struct MVMIOSyncWritable MVMIOSyncWritable;
+typedef struct MVMIOVecPiece MVMIOVecPiece;
 typedef struct MVMIOAsyncReadable MVMIOAsyncReadable;
 typedef struct MVMIOAsyncWritable MVMIOAsyncWritable;
 typedef struct MVMIOAsyncWritableTo MVMIOAsyncWritableTo;
@@ -0,0 +1,158 @@
+#include "moar.h"
+
+/* Measures how accept throughput scales with the number of listeners sharing
+ * an address (asynclistenshared, using SO_REUSEPORT). For 1, 2, 4, ... up
+ * to the given number of listeners, a number of client threads connect to
+ * the address and drop the connection again as fast as they can for a few
+ * seconds, while the main thread takes the accepted connections off the
+ * queue and closes them. The event loop count is set to the maximum number
+ * of listeners, so each listener gets a loop of its own.
+ *
+ *   make tools/accept_bench && ./tools/accept_bench [max_listeners] [clients]
+ */
+
+#ifndef _WIN32
+
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+
+#define BASE_PORT        45321
+#define SECONDS_PER_RUN  3
+
+typedef struct {
+    int       port;
+    MVMuint64 connects;
+} client;
+
+static volatile int clients_running;
+
+static void run_client(void *arg) {
+    client *c = (client *)arg;
+    struct sockaddr_in addr;
+    struct linger      no_linger;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family      = AF_INET;
+    addr.sin_port        = htons(c->port);
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+    /* Reset connections on close, so we don't run out of ports to TIME_WAIT. */
+    no_linger.l_onoff  = 1;
+    no_linger.l_linger = 0;
+
+    c->connects = 0;
+    while (clients_running) {
+        int fd = socket(AF_INET, SOCK_STREAM, 0);
+        if (fd < 0)
+            continue;
+        setsockopt(fd, SOL_SOCKET, SO_LINGER, &no_linger, sizeof(no_linger));
+        if (connect(fd, (struct sockaddr *)&addr, sizeof(addr)) == 0)
+            c->connects++;
+        close(fd);
+    }
+}
+
+/* Takes whatever the listeners delivered off the queue, closing accepted
+ * connections; returns the number of those. */
+static MVMuint64 drain(MVMThreadContext *tc, MVMObject *queue) {
+    MVMuint64  accepted = 0;
+    MVMObject *item;
+    while (!MVM_is_null(tc, item = MVM_concblockingqueue_poll(tc, (MVMConcBlockingQueue *)queue))) {
+        /* Connections come as [schedulee, socket, error, peer host, peer
+         * port, listener, host, port]; the listener reports it's listening
+         * with a shorter array. */
+        if (MVM_repr_elems(tc, item) == 8) {
+            MVMObject *socket = MVM_repr_at_pos_o(tc, item, 1);
+            if (IS_CONCRETE(socket)) {
+                MVM_io_close(tc, socket);
+                accepted++;
+            }
+        }
+    }
+    return accepted;
+}
+
+int main (int argc, char **argv) {
+    MVMInstance      *instance;
+    MVMThreadContext *tc;
+    MVMObject        *queue;
+    MVMString        *host;
+    MVMint32 max_listeners = argc > 1 ? atoi(argv[1]) : 4;
+    MVMint32 num_clients   = argc > 2 ? atoi(argv[2]) : 4;
+    MVMint32 num_listeners, i, run = 0;
+    MVMuint64 single = 0;
+    char loops[16];
+
+    snprintf(loops, sizeof(loops), "%d", max_listeners);
+    setenv("MVM_EVENT_LOOPS", loops, 0);
+    instance = MVM_vm_create_instance();
+    tc       = instance->main_thread;
+
+    /* Allocate straight into gen2, so the objects we hold in C variables do
+     * not move. */
+    MVM_gc_allocate_gen2_default_set(tc);
+    queue = MVM_repr_alloc_init(tc, instance->boot_types.BOOTQueue);
+    host  = MVM_string_ascii_decode_nt(tc, instance->VMString, "127.0.0.1");
+
+    fprintf(stderr, "%d client threads, %d s per run\n", num_clients, SECONDS_PER_RUN);
+    fprintf(stderr, "| listeners |   accepts/s | connects/s | speedup |\n");
+    for (num_listeners = 1; num_listeners <= max_listeners; num_listeners *= 2, run++) {
+        MVMObject  **listeners = MVM_malloc(num_listeners * sizeof(MVMObject *));
+        uv_thread_t *threads   = MVM_malloc(num_clients * sizeof(uv_thread_t));
+        client      *clients   = MVM_malloc(num_clients * sizeof(client));
+        int          port      = BASE_PORT + run;
+        MVMuint64    accepted  = 0, connects = 0, start, elapsed, rate;
+
+        for (i = 0; i < num_listeners; i++)
+            listeners[i] = MVM_io_socket_listen_shared_async(tc, queue,
+                instance->VMNull, host, port, 1024, instance->boot_types.BOOTAsync);
+        MVM_platform_sleep(0.2);
+        drain(tc, queue);
+
+        clients_running = 1;
+        start = uv_hrtime();
+        for (i = 0; i < num_clients; i++) {
+            clients[i].port = port;
+            uv_thread_create(&threads[i], run_client, &clients[i]);
+        }
+        while (uv_hrtime() - start < (MVMuint64)SECONDS_PER_RUN * 1000000000) {
+            accepted += drain(tc, queue);
+            MVM_gc_mark_thread_blocked(tc);
+            MVM_platform_sleep(0.001);
+            MVM_gc_mark_thread_unblocked(tc);
+        }
+        clients_running = 0;
+        for (i = 0; i < num_clients; i++) {
+            uv_thread_join(&threads[i]);
+            connects += clients[i].connects;
+        }
+        elapsed = uv_hrtime() - start;
+        accepted += drain(tc, queue);
+
+        rate = (MVMuint64)(accepted * 1e9 / elapsed);
+        if (num_listeners == 1)
+            single = rate;
+        fprintf(stderr, "| %9d | %11"PRIu64" | %10"PRIu64" | %6.2fx |\n", num_listeners,
+            rate, (MVMuint64)(connects * 1e9 / elapsed), single ? (double)rate / single : 0.0);
+
+        for (i = 0; i < num_listeners; i++)
+            MVM_io_eventloop_cancel_work(tc, listeners[i], NULL, NULL);
+        MVM_platform_sleep(0.2);
+        drain(tc, queue);
+
+        MVM_free(listeners);
+        MVM_free(threads);
+        MVM_free(clients);
+    }
+    return 0;
+}
+
+#else
+
+int main (int argc, char **argv) {
+    fprintf(stderr, "accept_bench needs SO_REUSEPORT, which Windows lacks\n");
+    return 1;
+}
+
+#endif
@@ -0,0 +1,100 @@
+#include "platform/memmem.h"
+#include "moar.h"
+#include "platform/memmem32.h"
+
+/* Shows what keeping Latin-1 text in 8-bit storage saves, compared to the
+ * 32-bit storage such text used to need as soon as it held a single é. The
+ * same generated text of French and German words is held both ways, and
+ * the operations that run directly on flat storage are timed on each:
+ *
+ *   - equality, which is a memcmp of the storage;
+ *   - compare, which finds the first differing grapheme;
+ *   - index of a word near the end.
+ *
+ *   make tools/latin1_storage_bench && ./tools/latin1_storage_bench [MiB]
+ *
+ * Each buffer holds the given number of MiB of graphemes (default 16).
+ */
+
+#define PASSES 20
+
+static const char *words[] = {
+    "caf\xE9", "na\xEFve", "\xE9l\xE8ve", "for\xEAt", "gar\xE7on", "No\xEBl", "\xE0",
+    "o\xF9", "tr\xE8s", "d\xE9j\xE0", "c\xF4t\xE9", "M\xFCnchen", "Stra\xDF" "e", "sch\xF6n",
+    "\xFC" "ber", "Gr\xFC\xDF" "e", "M\xE4" "dchen", "\xA9", "und", "der", "die", "le", "la",
+    "et", "est", "Haus", "maison", "Welt", "monde"
+};
+
+/* Keeps the compiler from dropping calls whose results are unused. */
+static volatile size_t sink;
+
+static void report(const char *name, MVMuint64 ns32, MVMuint64 ns8) {
+    fprintf(stderr, "%-26s %9.3f ms %9.3f ms %7.2fx\n", name,
+        ns32 / 1e6 / PASSES, ns8 / 1e6 / PASSES, (double)ns32 / ns8);
+}
+
+int main (int argc, char **argv) {
+    size_t    len = (argc > 1 ? (size_t)atoi(argv[1]) : 16) * 1024 * 1024;
+    uint8_t  *a8  = malloc(len), *b8 = malloc(len);
+    uint32_t *a32 = malloc(len * sizeof(uint32_t)), *b32 = malloc(len * sizeof(uint32_t));
+    uint32_t  needle32[16];
+    uint8_t   needle8[16];
+    size_t    i, p, needle_len;
+    MVMuint64 start, ns32, ns8;
+    MVMuint32 seed = 4242;
+
+    if (!len) {
+        fprintf(stderr, "Usage: %s [MiB]\n", argv[0]);
+        return 1;
+    }
+    for (i = 0; i < len; ) {
+        const char *word;
+        seed = seed * 1103515245 + 12345;
+        word = words[(seed >> 16) % (sizeof(words) / sizeof(words[0]))];
+        for (; *word && i < len; word++, i++)
+            a8[i] = (uint8_t)*word;
+        if (i < len)
+            a8[i++] = ' ';
+    }
+    /* A word that occurs only at the end, for index to find. */
+    needle_len = strlen("Wei\xDF" "bierglas");
+    memcpy(needle8, "Wei\xDF" "bierglas", needle_len);
+    memcpy(a8 + len - needle_len, needle8, needle_len);
+    memcpy(b8, a8, len);
+    b8[len - 1] = '!';
+    for (i = 0; i < len; i++) {
+        a32[i] = a8[i];
+        b32[i] = b8[i];
+    }
+    for (i = 0; i < needle_len; i++)
+        needle32[i] = needle8[i];
+
+    fprintf(stderr, "%"PRIu64" graphemes of Latin-1 text, mean of %d passes\n", (MVMuint64)len, PASSES);
+    fprintf(stderr, "%-26s %12s %12s\n", "storage", "32-bit", "8-bit");
+    fprintf(stderr, "%-26s %9.1f MiB %9.1f MiB\n", "size",
+        len * sizeof(uint32_t) / 1048576.0, len / 1048576.0);
+    fprintf(stderr, "%-26s %12s %12s %8s\n", "operation", "32-bit", "8-bit", "speedup");
+
+#define TIME(ns, expr) do { \
+        start = uv_hrtime(); \
+        for (p = 0; p < PASSES; p++) \
+            sink = (size_t)(expr); \
+        ns = uv_hrtime() - start; \
+    } while (0)
+
+    TIME(ns32, memcmp(a32, b32, len * sizeof(uint32_t)));
+    TIME(ns8, memcmp(a8, b8, len));
+    report("equality", ns32, ns8);
+    TIME(ns32, mismatch_uint32(a32, b32, len));
+    TIME(ns8, mismatch_uint8(a8, b8, len));
+    report("compare", ns32, ns8);
+    TIME(ns32, (char *)memmem_uint32(a32, len, needle32, needle_len) - (char *)a32);
+    TIME(ns8, (char *)MVM_memmem(a8, len, needle8, needle_len) - (char *)a8);
+    report("index of a word", ns32, ns8);
+
+    free(a8);
+    free(b8);
+    free(a32);
+    free(b32);
+    return 0;
+}
@@ -0,0 +1,126 @@
+/* Times the string search and comparison kernels in src/platform/memmem32.c
+ * against their scalar paths, which are the same source built here with
+ * SSE2 turned off. The SSE2 versions are the ones linked from libmoar.
+ *
+ *   make tools/string_kernels_bench && ./tools/string_kernels_bench [MiB]
+ *
+ * Each buffer holds the given number of MiB of graphemes (default 4), and
+ * each kernel is run over it enough times to take a measurable time.
+ */
+
+#undef __SSE2__
+#define memmem_uint32             scalar_memmem_uint32
+#define mismatch_uint32           scalar_mismatch_uint32
+#define mismatch_uint8            scalar_mismatch_uint8
+#define mismatch_uint32_grapheme8 scalar_mismatch_uint32_grapheme8
+#define find_uint8_in_range       scalar_find_uint8_in_range
+#include "platform/memmem32.c"
+#undef memmem_uint32
+#undef mismatch_uint32
+#undef mismatch_uint8
+#undef mismatch_uint32_grapheme8
+#undef find_uint8_in_range
+#include "platform/memmem32.h"
+
+#define PASSES 20
+
+typedef struct {
+    const char *name;
+    MVMuint64   bytes;
+    MVMuint64   scalar_ns;
+    MVMuint64   simd_ns;
+} result;
+
+static void report(result *r) {
+    fprintf(stderr, "%-34s %9.3f ms %9.3f ms %7.2fx %8.2f GB/s\n", r->name,
+        r->scalar_ns / 1e6 / PASSES, r->simd_ns / 1e6 / PASSES,
+        (double)r->scalar_ns / r->simd_ns, (double)r->bytes * PASSES / r->simd_ns);
+}
+
+/* Keeps the compiler from dropping calls whose results are unused. */
+static volatile size_t sink;
+
+int main (int argc, char **argv) {
+    size_t    len = (argc > 1 ? (size_t)atoi(argv[1]) : 4) * 1024 * 1024;
+    uint32_t *h32 = malloc(len * sizeof(uint32_t)), *o32 = malloc(len * sizeof(uint32_t));
+    uint8_t  *h8  = malloc(len), *o8 = malloc(len);
+    uint32_t  needle[8];
+    MVMuint64 start;
+    size_t    i, p, pos;
+    result    r;
+    MVMuint32 seed = 4242;
+
+    /* Lowercase words of 2 to 9 letters separated by spaces, in both
+     * widths, so neither kernel finds anything until near the end. */
+    for (i = 0; i < len; ) {
+        size_t word;
+        seed = seed * 1103515245 + 12345;
+        word = 2 + (seed >> 16) % 8;
+        for (; word && i < len; word--, i++) {
+            seed = seed * 1103515245 + 12345;
+            h8[i] = 'a' + (seed >> 16) % 26;
+        }
+        if (i < len)
+            h8[i++] = ' ';
+    }
+    for (i = 0; i < len; i++)
+        h32[i] = o32[i] = o8[i] = h8[i];
+    o32[len - 1] = o8[len - 1] = '!';
+    for (i = 0; i < 8; i++)
+        needle[i] = "QZQZQZQZ"[i];
+    memcpy(h32 + len - 8, needle, sizeof(needle));
+
+    fprintf(stderr, "%"PRIu64" graphemes per buffer, mean of %d passes\n", (MVMuint64)len, PASSES);
+    fprintf(stderr, "%-34s %12s %12s %8s %13s\n", "kernel", "scalar", "SSE2", "speedup", "SSE2 rate");
+
+#define TIME(field, expr) do { \
+        start = uv_hrtime(); \
+        for (p = 0; p < PASSES; p++) \
+            sink = (size_t)(expr); \
+        r.field = uv_hrtime() - start; \
+    } while (0)
+#define BENCH(label, size, scalar_expr, simd_expr) do { \
+        r.name  = (label); \
+        r.bytes = (size); \
+        TIME(scalar_ns, scalar_expr); \
+        TIME(simd_ns, simd_expr); \
+        report(&r); \
+    } while (0)
+
+    BENCH("index, 1 grapheme, 32-bit", len * 4,
+        scalar_memmem_uint32(h32, len, needle, 1), memmem_uint32(h32, len, needle, 1));
+    BENCH("index, 2 graphemes, 32-bit", len * 4,
+        scalar_memmem_uint32(h32, len, needle, 2), memmem_uint32(h32, len, needle, 2));
+    BENCH("index, 8 graphemes, 32-bit", len * 4,
+        scalar_memmem_uint32(h32, len, needle, 8), memmem_uint32(h32, len, needle, 8));
+    BENCH("compare, 32-bit vs 32-bit", len * 8,
+        scalar_mismatch_uint32(h32, o32, len), mismatch_uint32(h32, o32, len));
+    BENCH("compare, 8-bit vs 8-bit", len * 2,
+        scalar_mismatch_uint8(h8, o8, len), mismatch_uint8(h8, o8, len));
+    BENCH("compare, 32-bit vs 8-bit", len * 5,
+        scalar_mismatch_uint32_grapheme8(o32, h8, len), mismatch_uint32_grapheme8(o32, h8, len));
+
+    /* Finding every whitespace in the words, as a split would. */
+    r.name  = "find whitespace, 8-bit, all";
+    r.bytes = len;
+    start = uv_hrtime();
+    for (p = 0; p < PASSES; p++)
+        for (pos = 0; pos < len; pos++)
+            pos += scalar_find_uint8_in_range(h8 + pos, len - pos, '\t', '\r', ' ');
+    r.scalar_ns = uv_hrtime() - start;
+    start = uv_hrtime();
+    for (p = 0; p < PASSES; p++)
+        for (pos = 0; pos < len; pos++)
+            pos += find_uint8_in_range(h8 + pos, len - pos, '\t', '\r', ' ');
+    r.simd_ns = uv_hrtime() - start;
+    report(&r);
+    /* And a newline search, which finds none. */
+    BENCH("find newline, 8-bit, none", len,
+        scalar_find_uint8_in_range(h8, len, '\n', '\r', '\n'), find_uint8_in_range(h8, len, '\n', '\r', '\n'));
+
+    free(h32);
+    free(o32);
+    free(h8);
+    free(o8);
+    return 0;
+}